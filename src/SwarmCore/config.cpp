@@ -0,0 +1,48 @@
+// SwarmCore holds the client plumbing shared by the other Swarm mods
+// Currently the input dispatcher: one MissionGameplay.OnUpdate polls every registered Swarm keybind
+
+class CfgPatches
+{
+    class SwarmCore
+    {
+        units[] = {};
+        weapons[] = {};
+        requiredVersion = 0.1;
+        requiredAddons[] = {"DZ_Data", "DZ_Scripts"};
+    };
+};
+
+class CfgMods
+{
+    class SwarmCore
+    {
+        dir = "SwarmCore";
+        picture = "";
+        action = "";
+        hideName = 1;
+        hidePicture = 1;
+        name = "SwarmCore";
+        credits = "";
+        author = "Swarm";
+        authorID = "0";
+        version = "%VERSION%";
+        extra = 0;
+        type = "mod";
+
+        dependencies[] = {"Game", "Mission"};
+
+        class defs
+        {
+            class gameScriptModule
+            {
+                value = "";
+                files[] = {"SwarmCore/scripts/3_Game"};
+            };
+            class missionScriptModule
+            {
+                value = "";
+                files[] = {"SwarmCore/scripts/5_Mission"};
+            };
+        };
+    };
+};
@@ -0,0 +1,7 @@
+protocol = 1;
+publishedid = 0;
+name = "SwarmCore";
+timestamp = 0;
+version = "%VERSION%";
+author = "Swarm";
+description = "Shared client plumbing for Swarm mods";
@@ -0,0 +1,157 @@
+// When a binding fires
+enum SwarmInputEvent
+{
+	PRESS,
+	RELEASE,
+	HOLD_BEGIN
+}
+
+// Conditions a binding needs (flags)
+enum SwarmInputContext
+{
+	ANY = 0,
+	NO_MENU = 1, // No menu open
+	PLAYER = 2   // A local player exists
+}
+
+// One registered input
+class SwarmInputBinding
+{
+	string m_InputName;
+	UAInput m_Input;
+	int m_Event;
+	int m_Context;
+	ref ScriptInvoker m_Callback;
+	
+	void SwarmInputBinding(string inputName, UAInput input, int ev, int context)
+	{
+		m_InputName = inputName;
+		m_Input = input;
+		m_Event = ev;
+		m_Context = context;
+		m_Callback = new ScriptInvoker();
+	}
+	
+	bool Fired()
+	{
+		switch (m_Event)
+		{
+			case SwarmInputEvent.PRESS: return m_Input.LocalPress();
+			case SwarmInputEvent.RELEASE: return m_Input.LocalRelease();
+			case SwarmInputEvent.HOLD_BEGIN: return m_Input.LocalHoldBegin();
+		}
+		return false;
+	}
+}
+
+// Client input dispatcher shared by every Swarm mod
+// Mods bind their inputs once (usually in MissionGameplay.OnInit) and insert a callback into the returned invoker:
+//     SwarmInputDispatcher.GetInstance().Bind("UAMyInput", SwarmInputEvent.PRESS, SwarmInputContext.NO_MENU).Insert(OnMyInput);
+// SwarmCore's MissionGameplay.OnUpdate then polls only the bound inputs, through UAInput handles resolved at bind
+// time, and evaluates each context condition at most once per frame. Mods that need a per-frame tick insert into
+// GetOnFrame() while they need it and remove themselves afterwards. Everything is dropped when the mission ends.
+class SwarmInputDispatcher
+{
+	private static ref SwarmInputDispatcher s_Instance;
+	
+	protected ref array<ref SwarmInputBinding> m_Bindings;
+	protected ref ScriptInvoker m_OnFrame; // (float timeslice)
+	protected int m_ContextsUsed; // Union of the bindings' contexts
+	
+	void SwarmInputDispatcher()
+	{
+		m_Bindings = new array<ref SwarmInputBinding>;
+		m_OnFrame = new ScriptInvoker();
+	}
+	
+	// Get singleton instance
+	static SwarmInputDispatcher GetInstance()
+	{
+		if (!s_Instance)
+		{
+			s_Instance = new SwarmInputDispatcher();
+		}
+		return s_Instance;
+	}
+	
+	// The instance if there is one, without creating it (null after Reset)
+	// Teardown code such as destructors uses this so it never brings back a dispatcher for a finished mission
+	static SwarmInputDispatcher Get()
+	{
+		return s_Instance;
+	}
+	
+	// Drop every binding and frame callback (called when the mission ends)
+	static void Reset()
+	{
+		s_Instance = null;
+	}
+	
+	// Bind an input from inputs.xml, returns the invoker to insert the callback into (no arguments)
+	// Binding the same input, event and context twice returns the same invoker.
+	ScriptInvoker Bind(string inputName, int ev, int context = SwarmInputContext.NO_MENU)
+	{
+		foreach (SwarmInputBinding existing : m_Bindings)
+		{
+			if (existing.m_InputName == inputName && existing.m_Event == ev && existing.m_Context == context)
+				return existing.m_Callback;
+		}
+		
+		UAInput input = GetUApi().GetInputByName(inputName);
+		if (!input)
+		{
+			Print("[SwarmCore] Unknown input: " + inputName);
+			return new ScriptInvoker(); // Never fires
+		}
+		
+		SwarmInputBinding binding = new SwarmInputBinding(inputName, input, ev, context);
+		m_Bindings.Insert(binding);
+		m_ContextsUsed |= context;
+		return binding.m_Callback;
+	}
+	
+	// Remove every binding of an input
+	void Unbind(string inputName)
+	{
+		m_ContextsUsed = 0;
+		for (int i = m_Bindings.Count() - 1; i >= 0; i--)
+		{
+			if (m_Bindings[i].m_InputName == inputName)
+				m_Bindings.Remove(i);
+			else
+				m_ContextsUsed |= m_Bindings[i].m_Context;
+		}
+	}
+	
+	// Per-frame callbacks (float timeslice)
+	ScriptInvoker GetOnFrame()
+	{
+		return m_OnFrame;
+	}
+	
+	// Poll the bound inputs and run the frame callbacks (called from MissionGameplay.OnUpdate)
+	void OnUpdate(float timeslice)
+	{
+		if (m_Bindings.Count() > 0)
+		{
+			// Conditions nobody asked for are never evaluated
+			int contexts = 0;
+			if ((m_ContextsUsed & SwarmInputContext.NO_MENU) && GetGame().GetUIManager().GetMenu() == null)
+				contexts |= SwarmInputContext.NO_MENU;
+			if ((m_ContextsUsed & SwarmInputContext.PLAYER) && GetGame().GetPlayer())
+				contexts |= SwarmInputContext.PLAYER;
+			
+			foreach (SwarmInputBinding binding : m_Bindings)
+			{
+				if ((binding.m_Context & contexts) != binding.m_Context)
+					continue;
+				
+				if (binding.Fired())
+					binding.m_Callback.Invoke();
+			}
+		}
+		
+		if (m_OnFrame.Count() > 0)
+			m_OnFrame.Invoke(timeslice);
+	}
+}
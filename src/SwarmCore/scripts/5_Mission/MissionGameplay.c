@@ -0,0 +1,16 @@
+modded class MissionGameplay
+{
+	override void OnUpdate(float timeslice)
+	{
+		super.OnUpdate(timeslice);
+		
+		SwarmInputDispatcher.GetInstance().OnUpdate(timeslice);
+	}
+	
+	override void OnMissionFinish()
+	{
+		SwarmInputDispatcher.Reset();
+		
+		super.OnMissionFinish();
+	}
+}
@@ -10,7 +10,7 @@ class CfgPatches
 {
     class SwarmEarplugs
     {
-        requiredAddons[] = {};
+        requiredAddons[] = {"SwarmCore"};
     };
 };
 
@@ -0,0 +1,261 @@
+// How the volume moves from one level to the next
+enum EarPlugsCurve
+{
+	LINEAR,
+	SMOOTH,   // slow start and slow end
+	EASE_IN,  // slow start
+	EASE_OUT  // slow end
+}
+
+// One volume level as written in the json file
+class EarPlugsLevel
+{
+	float Volume;   // 0 (muted) to 1 (full)
+	float RampTime; // seconds to reach this level
+	string Icon;    // full, mid, low or off
+
+	void EarPlugsLevel(float volume = 1, float rampTime = 1, string icon = "full")
+	{
+		Volume = volume;
+		RampTime = rampTime;
+		Icon = icon;
+	}
+}
+
+// A named list of levels the toggle key cycles through
+class EarPlugsProfile
+{
+	string Name;
+	autoptr array<ref EarPlugsLevel> Levels;
+
+	void EarPlugsProfile(string name = "")
+	{
+		Name = name;
+		Levels = new array<ref EarPlugsLevel>;
+	}
+}
+
+// The earplugs settings, $profile:SwarmEarplugs\earplugs.json on the client, created with the classic four levels
+// the first time the game starts with the mod
+class EarPlugsConfig
+{
+	static const string DIR_EARPLUGS = "$profile:SwarmEarplugs\\";
+	static const string FILE_EARPLUGS = DIR_EARPLUGS + "earplugs.json";
+
+	string ActiveProfile;
+	string Curve;       // linear, smooth, easein or easeout
+	float MuteRampTime; // seconds, for the hold-to-mute key
+	autoptr array<ref EarPlugsProfile> Profiles;
+
+	void EarPlugsConfig()
+	{
+		Profiles = new array<ref EarPlugsProfile>;
+	}
+
+	void Defaults()
+	{
+		ActiveProfile = "Classic";
+		Curve = "smooth";
+		MuteRampTime = 0.25;
+
+		EarPlugsProfile classic = new EarPlugsProfile("Classic");
+		classic.Levels.Insert(new EarPlugsLevel(1, 1, "full"));
+		classic.Levels.Insert(new EarPlugsLevel(0.45, 1, "mid"));
+		classic.Levels.Insert(new EarPlugsLevel(0.08, 1, "low"));
+		classic.Levels.Insert(new EarPlugsLevel(0, 1, "off"));
+
+		Profiles.Clear();
+		Profiles.Insert(classic);
+	}
+
+	// Load the file (or write the defaults if there is none) and compile the active profile
+	static EarPlugsLevels Load()
+	{
+		EarPlugsConfig config = new EarPlugsConfig();
+		if (FileExist(FILE_EARPLUGS))
+		{
+			JsonFileLoader<EarPlugsConfig>.JsonLoadFile(FILE_EARPLUGS, config);
+		}
+		else
+		{
+			config.Defaults();
+			MakeDirectory(DIR_EARPLUGS);
+			JsonFileLoader<EarPlugsConfig>.JsonSaveFile(FILE_EARPLUGS, config);
+		}
+
+		EarPlugsLevels levels = new EarPlugsLevels();
+		if (!levels.Compile(config))
+		{
+			Print("[SwarmEarplugs] " + FILE_EARPLUGS + " has no usable profile, using the classic levels");
+			config.Defaults();
+			levels = new EarPlugsLevels();
+			levels.Compile(config);
+		}
+		return levels;
+	}
+}
+
+// The active profile compiled into plain arrays, so toggling is just an index lookup
+class EarPlugsLevels
+{
+	ref array<float> m_Volumes;
+	ref array<float> m_RampTimes;
+	ref array<int> m_Icons; // EarPlugsIcon
+	int m_Curve;            // EarPlugsCurve
+	float m_MuteRampTime;
+
+	void EarPlugsLevels()
+	{
+		m_Volumes = new array<float>;
+		m_RampTimes = new array<float>;
+		m_Icons = new array<int>;
+	}
+
+	int Count()
+	{
+		return m_Volumes.Count();
+	}
+
+	bool Compile(EarPlugsConfig config)
+	{
+		// The active profile, or the first one if it is not found
+		EarPlugsProfile profile = null;
+		foreach (EarPlugsProfile candidate : config.Profiles)
+		{
+			if (!profile || candidate.Name == config.ActiveProfile)
+				profile = candidate;
+
+			if (candidate.Name == config.ActiveProfile)
+				break;
+		}
+
+		if (!profile || profile.Levels.Count() == 0)
+			return false;
+
+		foreach (EarPlugsLevel level : profile.Levels)
+		{
+			float volume = Math.Clamp(level.Volume, 0, 1);
+			m_Volumes.Insert(volume);
+			m_RampTimes.Insert(Math.Max(level.RampTime, 0));
+			m_Icons.Insert(GetIcon(level.Icon, volume));
+		}
+
+		m_Curve = GetCurve(config.Curve);
+		m_MuteRampTime = Math.Max(config.MuteRampTime, 0);
+		return true;
+	}
+
+	// Icon name to EarPlugsIcon, picked from the volume if the name is unknown
+	static int GetIcon(string icon, float volume)
+	{
+		icon.ToLower();
+		switch (icon)
+		{
+			case "full": return EarPlugsIcon.FULL;
+			case "mid": return EarPlugsIcon.MID;
+			case "low": return EarPlugsIcon.LOW;
+			case "off": return EarPlugsIcon.OFF;
+		}
+
+		if (volume <= 0)
+			return EarPlugsIcon.OFF;
+		if (volume < 0.25)
+			return EarPlugsIcon.LOW;
+		if (volume < 0.75)
+			return EarPlugsIcon.MID;
+		return EarPlugsIcon.FULL;
+	}
+
+	static int GetCurve(string curve)
+	{
+		curve.ToLower();
+		switch (curve)
+		{
+			case "linear": return EarPlugsCurve.LINEAR;
+			case "easein": return EarPlugsCurve.EASE_IN;
+			case "easeout": return EarPlugsCurve.EASE_OUT;
+		}
+		return EarPlugsCurve.SMOOTH;
+	}
+}
+
+// Moves the game volume to a target over time, one step per frame from the SwarmCore dispatcher
+// Only registered for frame updates while a ramp is running, and a new ramp simply replaces the old one.
+class EarPlugsVolumeRamp extends Managed
+{
+	protected float m_Volume = 1; // What we last set
+	protected float m_From;
+	protected float m_To;
+	protected float m_Duration;
+	protected float m_Elapsed;
+	protected int m_Curve;
+	protected bool m_Running;
+
+	void ~EarPlugsVolumeRamp()
+	{
+		Stop();
+	}
+
+	// Ramp from the current volume to volume over duration seconds (0 sets it straight away)
+	void Start(float volume, float duration, int curve)
+	{
+		if (duration <= 0)
+		{
+			Stop();
+			Apply(volume);
+			return;
+		}
+
+		m_From = m_Volume;
+		m_To = volume;
+		m_Duration = duration;
+		m_Elapsed = 0;
+		m_Curve = curve;
+
+		if (!m_Running)
+		{
+			SwarmInputDispatcher.GetInstance().GetOnFrame().Insert(OnFrame);
+			m_Running = true;
+		}
+	}
+
+	void OnFrame(float timeslice)
+	{
+		m_Elapsed += timeslice;
+		float t = Math.Clamp(m_Elapsed / m_Duration, 0, 1);
+
+		Apply(m_From + (m_To - m_From) * Shape(t));
+
+		if (t >= 1)
+			Stop();
+	}
+
+	protected float Shape(float t)
+	{
+		switch (m_Curve)
+		{
+			case EarPlugsCurve.LINEAR: return t;
+			case EarPlugsCurve.EASE_IN: return t * t;
+			case EarPlugsCurve.EASE_OUT: return 1 - (1 - t) * (1 - t);
+		}
+		return t * t * (3 - 2 * t);
+	}
+
+	protected void Apply(float volume)
+	{
+		m_Volume = volume;
+		GetGame().GetSoundScene().SetSoundVolume(volume, 0);
+	}
+
+	protected void Stop()
+	{
+		if (!m_Running)
+			return;
+
+		// Also runs from the destructor after the mission has reset the dispatcher, so never create one here
+		SwarmInputDispatcher dispatcher = SwarmInputDispatcher.Get();
+		if (dispatcher)
+			dispatcher.GetOnFrame().Remove(OnFrame);
+		m_Running = false;
+	}
+}
@@ -1,11 +1,30 @@
+// The volume icons, this is also the image slot each one is loaded into
+enum EarPlugsIcon
+{
+	FULL,
+	MID,
+	LOW,
+	OFF,
+	COUNT
+}
+
 // We are creating a new class named EarPlugsWidget and Exending Managed so there is memory clean up.
 class EarPlugsWidget extends Managed
 {
+	// How long the icon stays (almost) solid and how long it then takes to fade out, in seconds
+	static const float ICON_HOLD_TIME = 0.6;
+	static const float ICON_FADE_TIME = 0.8;
+	// Alpha at the end of the hold, so it still looks solid but you can see it is about to go
+	static const float ICON_HOLD_ALPHA = 0.9;
+
 	// We are declaring a ImageWidget variable so we can reference it when neasary
 	autoptr ImageWidget m_icon;
 
-	// To make sure we can remove the call que if its active we will have a bool called call
-	float m_iconalpha = 0;
+	// How long the current icon has been on screen, only counted while the icon is fading
+	float m_iconTime = 0;
+
+	// True while we are registered for frame updates
+	bool m_fading = false;
 
 	// When an object of the class is instantiate(created) then we need to create the widget
 	void EarPlugsWidget()
@@ -16,8 +35,11 @@ class EarPlugsWidget extends Managed
 		// Setting the icon to be hidden by default
 		m_icon.Show(false);
 
-		// you could set the default image path in the layout but just going to set it here to show you how
-		// m_icon.LoadImageFile( 0, "SwarmEarplugs\\data\\volume_up.edds" );
+		// Load every icon once into its own image slot, switching icons later is just picking a slot so it never hitches
+		m_icon.LoadImageFile(EarPlugsIcon.FULL, "SwarmEarplugs\\data\\volume_full.edds");
+		m_icon.LoadImageFile(EarPlugsIcon.MID, "SwarmEarplugs\\data\\volume_mid.edds");
+		m_icon.LoadImageFile(EarPlugsIcon.LOW, "SwarmEarplugs\\data\\volume_low.edds");
+		m_icon.LoadImageFile(EarPlugsIcon.OFF, "SwarmEarplugs\\data\\volume_off.edds");
 	}
 
 	// When an object of the object is destroyed this class is called
@@ -26,62 +48,73 @@ class EarPlugsWidget extends Managed
 		// first we make sure the image is hidden
 		m_icon.Show(false);
 
-		// If the call Queue is currently active remove it to prevent null pointer errors
-		if (m_iconalpha != 0)
-		{
-			GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(this.HideIcon);
-		}
+		// If we are still fading stop the frame updates to prevent null pointer errors
+		StopFade();
 
 		// Then delete the reference to the icon widget
 		delete m_icon;
 	}
 
-	// This is the function we will calling to change the image for the icon
-	void SetIcon(string imagePath)
+	// This is the function we will calling to change the image for the icon, icon is one of EarPlugsIcon
+	void SetIcon(int icon)
 	{
-
-		// This set the image to the image path provided in the function call
-		m_icon.LoadImageFile(0, imagePath);
+		// Pick the preloaded image
+		m_icon.SetImage(icon);
 
 		// Since it will now be hidden we need to show it as well
 		m_icon.Show(true);
 
-		// Setting the new alpha to be 1 reseting it so the icon shows up
-		m_iconalpha = 1;
-		// Set the icons Alpha back to full
-		m_icon.SetAlpha(m_iconalpha);
+		// Start the fade from the beginning and set the icons Alpha back to full
+		m_iconTime = 0;
+		m_icon.SetAlpha(1);
 
-		// Creating a call Queue to hide the Icon in a loop slowly reduce the alpha till its 0
-		GetGame().GetCallQueue(CALL_CATEGORY_GUI).CallLater(this.HideIcon, 20, true);
+		// Ask the SwarmCore input dispatcher to call us every frame until the icon is gone
+		if (!m_fading)
+		{
+			SwarmInputDispatcher.GetInstance().GetOnFrame().Insert(OnFrame);
+			m_fading = true;
+		}
 	}
 
-	// This is the function we will use to fade the icon off the screen
-	void HideIcon()
+	// Called every frame while the icon is on screen, timeslice is the frame time in seconds so the fade takes
+	// the same time at any frame rate
+	void OnFrame(float timeslice)
 	{
+		m_iconTime += timeslice;
 
-		// If the alpha is over 90% reduce it at a slower rate should make it apear more solid for longers
-		if (m_iconalpha > 0.90)
+		float alpha;
+		if (m_iconTime < ICON_HOLD_TIME)
 		{
-			m_iconalpha = m_iconalpha - 0.0035;
+			// Fade slowly at first so it apears more solid for longer
+			alpha = 1 - (1 - ICON_HOLD_ALPHA) * (m_iconTime / ICON_HOLD_TIME);
 		}
 		else
-		{ // else reduce it at its normal rate to have the fade affect
-			m_iconalpha = m_iconalpha - 0.022;
+		{
+			// then fade the rest of the way out
+			alpha = ICON_HOLD_ALPHA * (1 - (m_iconTime - ICON_HOLD_TIME) / ICON_FADE_TIME);
 		}
 
-		if (m_iconalpha <= 0)
+		if (alpha <= 0)
 		{
-			// Hiding the icon off the screen
+			// Hiding the icon off the screen and stop the frame updates, so nothing runs while it is hidden
 			m_icon.Show(false);
-
-			// Set Alpha to 0 to make sure we know that the call queue has stopped running
-			m_iconalpha = 0;
-
-			// remove the call from the Queue
-			GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(this.HideIcon);
+			StopFade();
+			return;
 		}
 
 		// Setting the icons alpha
-		m_icon.SetAlpha(m_iconalpha);
+		m_icon.SetAlpha(alpha);
+	}
+
+	protected void StopFade()
+	{
+		if (!m_fading)
+			return;
+
+		// Also runs from the destructor after the mission has reset the dispatcher, so never create one here
+		SwarmInputDispatcher dispatcher = SwarmInputDispatcher.Get();
+		if (dispatcher)
+			dispatcher.GetOnFrame().Remove(OnFrame);
+		m_fading = false;
 	}
 }
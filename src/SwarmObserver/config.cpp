@@ -33,6 +33,11 @@ class CfgMods
 		
 		dependencies[] = {"Game","World","Mission"};
 		
+		// Optional compile-time feature stripping: uncomment to remove a subsystem entirely
+		// SWARM_OBSERVER_NO_COMBAT removes combat tracking (hit/fire/explosive hooks, combat webhooks)
+		// SWARM_OBSERVER_NO_ZONES removes restricted areas (grace periods, history, reconnect notice)
+		// defines[] = {"SWARM_OBSERVER_NO_COMBAT", "SWARM_OBSERVER_NO_ZONES"};
+		
 		class defs
 		{
 			class gameScriptModule
@@ -0,0 +1,222 @@
+// Benchmark settings (benchmark.json, created with defaults on the first benchmark run)
+// Benchmarks only run when the server is started with -swarmObserverBenchmark[=players] (combat load) or
+// -swarmObserverHistoryBenchmark[=sizes] (history store). While one is active the real history file is never
+// written, webhooks are never posted and cluster logs are never written. Once every benchmark has finished the
+// server goes back to normal operation with the real history, unless ExitWhenDone shuts it down.
+class SwarmObserverBenchmarkSettings
+{
+	private static ref SwarmObserverBenchmarkSettings s_Instance;
+	private static bool s_Active;
+	private static bool s_LoadBenchmark;
+	private static bool s_HistoryBenchmark;
+	private static int s_Pending; // Benchmarks still running
+	
+	// Dummy players, spawned in square clusters laid out on a grid starting at Origin
+	int PlayerCount;
+	int ClusterSize;
+	float ClusterSpacing;
+	float ClusterRadius;
+	vector Origin;
+	string PlayerType;
+	
+	// Load is driven during the warmup too, only the measured phase is reported
+	int WarmupSeconds;
+	int DurationSeconds;
+	
+	// Load rates
+	float HitsPerSecond;
+	int FullAutoShooters; // Players firing at the same time, one round each per BENCHMARK_TICK_MS
+	int BurstLength;
+	float GrenadesPerSecond;
+	float LogoutsPerSecond;
+	string AmmoType;
+	
+	// History store benchmark: synthetic player counts, and lookups / increments timed per count
+	autoptr array<int> HistorySizes;
+	int HistoryLookups;
+	int HistoryMutations;
+	
+	// Shut the server down once every report is written
+	bool ExitWhenDone;
+	
+	void SwarmObserverBenchmarkSettings()
+	{
+		HistorySizes = new array<int>;
+		Defaults();
+	}
+	
+	void Defaults()
+	{
+		PlayerCount = 100;
+		ClusterSize = 10;
+		ClusterSpacing = 500;
+		ClusterRadius = 25;
+		Origin = Vector(6000, 0, 6000);
+		PlayerType = "SurvivorM_Mirek";
+		
+		WarmupSeconds = 10;
+		DurationSeconds = 120;
+		
+		HitsPerSecond = 20;
+		FullAutoShooters = 5;
+		BurstLength = 30;
+		GrenadesPerSecond = 1;
+		LogoutsPerSecond = 0.5;
+		AmmoType = "Bullet_762x39";
+		
+		HistorySizes.Clear();
+		HistorySizes.Insert(10000);
+		HistorySizes.Insert(100000);
+		HistorySizes.Insert(500000);
+		HistoryLookups = 10000;
+		HistoryMutations = 20; // Each one saves the whole history, as in production
+		
+		ExitWhenDone = true;
+	}
+	
+	// Get singleton instance
+	static SwarmObserverBenchmarkSettings GetInstance()
+	{
+		if (!s_Instance)
+		{
+			s_Instance = new SwarmObserverBenchmarkSettings();
+		}
+		return s_Instance;
+	}
+	
+	// True while any benchmark is active
+	static bool IsActive()
+	{
+		return s_Active;
+	}
+	
+	static bool IsLoadBenchmark()
+	{
+		return s_LoadBenchmark;
+	}
+	
+	static bool IsHistoryBenchmark()
+	{
+		return s_HistoryBenchmark;
+	}
+	
+	// Enable benchmark mode if a launch parameter is present (called first thing in SwarmObserverModule.Initialize)
+	// A numeric load value overrides PlayerCount, a comma separated history value overrides HistorySizes.
+	static void Detect()
+	{
+		if (!GetGame().IsDedicatedServer())
+			return;
+		
+		string loadValue;
+		string historyValue;
+		bool load = GetCLIParam(SwarmObserverConstants.CLI_BENCHMARK, loadValue);
+		bool history = GetCLIParam(SwarmObserverConstants.CLI_HISTORY_BENCHMARK, historyValue);
+		
+		#ifdef SWARM_OBSERVER_NO_COMBAT
+		if (load)
+			Print("[SwarmObserver] Load benchmark ignored: it drives the combat pipeline, which is compiled out");
+		load = false;
+		#endif
+		
+		#ifdef SWARM_OBSERVER_NO_ZONES
+		if (history)
+			Print("[SwarmObserver] History benchmark ignored: the history is compiled out");
+		history = false;
+		#endif
+		
+		if (!load && !history)
+			return;
+		
+		SwarmObserverBenchmarkSettings settings = GetInstance();
+		if (FileExist(SwarmObserverConstants.FILE_BENCHMARK_CONFIG))
+		{
+			JsonFileLoader<SwarmObserverBenchmarkSettings>.JsonLoadFile(SwarmObserverConstants.FILE_BENCHMARK_CONFIG, settings);
+		}
+		else
+		{
+			JsonFileLoader<SwarmObserverBenchmarkSettings>.JsonSaveFile(SwarmObserverConstants.FILE_BENCHMARK_CONFIG, settings);
+			Print("[SwarmObserver] Benchmark config created with defaults");
+		}
+		
+		if (loadValue.ToInt() > 0)
+			settings.PlayerCount = loadValue.ToInt();
+		
+		settings.PlayerCount = Math.Max(settings.PlayerCount, 2);
+		settings.ClusterSize = Math.Max(settings.ClusterSize, 2);
+		settings.BurstLength = Math.Max(settings.BurstLength, 1);
+		
+		if (historyValue != "")
+		{
+			array<string> sizes = new array<string>;
+			historyValue.Split(",", sizes);
+			settings.HistorySizes.Clear();
+			foreach (string size : sizes)
+			{
+				if (size.ToInt() > 0)
+					settings.HistorySizes.Insert(size.ToInt());
+			}
+		}
+		
+		s_Active = true;
+		s_LoadBenchmark = load;
+		s_HistoryBenchmark = history;
+		s_Pending = 0;
+		if (load)
+			s_Pending++;
+		if (history)
+			s_Pending++;
+		
+		Print("[SwarmObserver] BENCHMARK MODE (real history file, webhooks and cluster logs disabled)");
+		if (load)
+			Print("[SwarmObserver]   - Combat load: " + settings.PlayerCount + " synthetic players for " + settings.DurationSeconds + "s");
+		if (history)
+			Print("[SwarmObserver]   - History store: " + settings.HistorySizes.Count() + " dataset sizes");
+	}
+	
+	// Called by each benchmark once its report is written and its synthetic players are gone
+	static void Finished()
+	{
+		s_Pending--;
+		if (s_Pending > 0)
+			return;
+		
+		if (GetInstance().ExitWhenDone)
+		{
+			GetGame().RequestExit(0);
+			return;
+		}
+		
+		Deactivate();
+	}
+	
+	// Leave benchmark mode: synthetic violations only ever lived in memory, so reloading the real history drops them,
+	// then webhooks come back with a fresh settings snapshot and cluster mode starts if it is configured
+	private static void Deactivate()
+	{
+		s_Active = false;
+		s_LoadBenchmark = false;
+		s_HistoryBenchmark = false;
+		
+		#ifndef SWARM_OBSERVER_NO_ZONES
+		SwarmObserverHistory.SetFilePath(SwarmObserverConstants.FILE_HISTORY);
+		SwarmObserverHistory.LoadHistory();
+		#endif
+		
+		SwarmObserverSettingsSnapshot.Publish(new SwarmObserverSettingsSnapshot(SwarmObserverSettings.GetInstance()));
+		
+		#ifndef SWARM_OBSERVER_NO_ZONES
+		SwarmObserverCluster.Initialize();
+		#endif
+		
+		Print("[SwarmObserver] Benchmark mode ended, real history reloaded and webhooks, saving and cluster sync re-enabled");
+	}
+	
+	// Local time as yyyymmdd_hhmmss, for report file names
+	static string GetReportStamp()
+	{
+		int year, month, day, hour, minute, second;
+		GetYearMonthDay(year, month, day);
+		GetHourMinuteSecond(hour, minute, second);
+		return year.ToString() + month.ToStringLen(2) + day.ToStringLen(2) + "_" + hour.ToStringLen(2) + minute.ToStringLen(2) + second.ToStringLen(2);
+	}
+}
@@ -0,0 +1,358 @@
+#ifndef SWARM_OBSERVER_NO_ZONES
+// Read position in another server's log
+class SwarmObserverClusterOffset
+{
+	string ServerID;
+	int Segment;
+	int Line;
+	
+	void SwarmObserverClusterOffset(string serverID = "", int segment = 0, int line = 0)
+	{
+		ServerID = serverID;
+		Segment = segment;
+		Line = line;
+	}
+}
+
+// Local cluster bookkeeping (kept in this server's profile, never shared)
+class SwarmObserverClusterState
+{
+	int Sequence;     // Last violation sequence number issued by this server
+	int Segment;      // Segment this server currently appends to
+	int SegmentLines; // Lines already written to that segment
+	autoptr array<ref SwarmObserverClusterOffset> Offsets;
+	
+	void SwarmObserverClusterState()
+	{
+		Sequence = 0;
+		Segment = 0;
+		SegmentLines = 0;
+		Offsets = new array<ref SwarmObserverClusterOffset>;
+	}
+}
+
+// Shared violation history across servers
+// Every server appends its own violations and acknowledgements to <ClusterDirectory>\<ServerID>\<segment>.log and
+// periodically merges the other servers' logs from its saved (segment, line) offset. Violation IDs are
+// "<ServerID>:<sequence>", so merging is conflict-free and idempotent. Enforce files cannot seek, so logs are cut
+// into CLUSTER_SEGMENT_LINES segments: a merge re-reads at most the current segment, never the whole history.
+//
+// Line format (fields are sanitized, the trailing ";" marks a complete line):
+//   V|<id>|<steamID>|<playerName>|<areaName>|<timestamp>|;
+//   A|<steamID>|<timestamp>|;
+class SwarmObserverCluster
+{
+	private static ref SwarmObserverCluster s_Instance;
+	private bool m_Enabled;
+	private string m_Directory;
+	private string m_ServerID;
+	private ref SwarmObserverClusterState m_State;
+	private ref map<string, SwarmObserverClusterOffset> m_Offsets;
+	
+	void SwarmObserverCluster()
+	{
+		m_Enabled = false;
+		m_State = new SwarmObserverClusterState();
+		m_Offsets = new map<string, SwarmObserverClusterOffset>;
+	}
+	
+	// Get singleton instance
+	static SwarmObserverCluster GetInstance()
+	{
+		if (!s_Instance)
+		{
+			s_Instance = new SwarmObserverCluster();
+		}
+		return s_Instance;
+	}
+	
+	static bool IsEnabled()
+	{
+		return GetInstance().m_Enabled;
+	}
+	
+	// Start cluster mode if configured (called after the history is loaded; changes need a restart)
+	static void Initialize()
+	{
+		SwarmObserverSettings settings = SwarmObserverSettings.GetInstance();
+		if (!settings.ClusterEnabled)
+			return;
+		
+		// A benchmark run must not publish synthetic violations to the other servers
+		if (SwarmObserverBenchmarkSettings.IsActive())
+		{
+			Print("[SwarmObserver] Cluster mode disabled for the benchmark run");
+			return;
+		}
+		
+		SwarmObserverCluster cluster = GetInstance();
+		cluster.m_Enabled = true;
+		cluster.m_ServerID = settings.ServerID;
+		cluster.m_Directory = settings.ClusterDirectory;
+		if (cluster.m_Directory == "")
+			cluster.m_Directory = SwarmObserverConstants.DIR_CLUSTER_DEFAULT;
+		if (cluster.m_Directory.Substring(cluster.m_Directory.Length() - 1, 1) != "\\")
+			cluster.m_Directory += "\\";
+		
+		MakeDirectory(cluster.m_Directory);
+		MakeDirectory(cluster.m_Directory + cluster.m_ServerID);
+		
+		cluster.LoadState();
+		
+		Print("[SwarmObserver] Cluster mode enabled as " + cluster.m_ServerID + " (directory: " + cluster.m_Directory + ")");
+		
+		cluster.Merge();
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(cluster.Merge, settings.ClusterMergeIntervalSeconds * 1000, true);
+	}
+	
+	// Append a violation to this server's log and return its cluster-wide ID ("" when cluster mode is off)
+	string AppendViolation(string steamID, string playerName, string areaName, string timestamp)
+	{
+		if (!m_Enabled)
+			return "";
+		
+		m_State.Sequence++;
+		string id = m_ServerID + ":" + m_State.Sequence;
+		AppendLine("V|" + id + "|" + Sanitize(steamID) + "|" + Sanitize(playerName) + "|" + Sanitize(areaName) + "|" + Sanitize(timestamp) + "|;");
+		return id;
+	}
+	
+	// Append an acknowledgement so the other servers see it too
+	void AppendAcknowledgement(string steamID, string timestamp)
+	{
+		if (!m_Enabled)
+			return;
+		
+		AppendLine("A|" + Sanitize(steamID) + "|" + Sanitize(timestamp) + "|;");
+	}
+	
+	// Merge new lines from every other server's log (called by timer)
+	void Merge()
+	{
+		if (!m_Enabled)
+			return;
+		
+		int merged = 0;
+		
+		string fileName;
+		FileAttr fileAttr;
+		FindFileHandle handle = FindFile(m_Directory + "*", fileName, fileAttr, 0);
+		if (handle)
+		{
+			bool found = true;
+			while (found)
+			{
+				if ((fileAttr & FileAttr.DIRECTORY) && fileName != "." && fileName != ".." && fileName != m_ServerID)
+					merged += MergeServer(fileName);
+				
+				found = FindNextFile(handle, fileName, fileAttr);
+			}
+			CloseFindFile(handle);
+		}
+		
+		if (merged > 0)
+		{
+			SwarmObserverHistory.SaveHistory();
+			SaveState();
+			Print("[SwarmObserver] Cluster merge applied " + merged + " entries from other servers");
+		}
+	}
+	
+	// Read one server's log from its saved offset, returns the number of lines applied
+	private int MergeServer(string serverID)
+	{
+		SwarmObserverClusterOffset offset;
+		if (!m_Offsets.Find(serverID, offset))
+		{
+			offset = new SwarmObserverClusterOffset(serverID, 0, 0);
+			m_State.Offsets.Insert(offset);
+			m_Offsets.Set(serverID, offset);
+		}
+		
+		int applied = 0;
+		bool advanced = false;
+		
+		while (true)
+		{
+			string path = GetSegmentPath(serverID, offset.Segment);
+			if (!FileExist(path))
+				break;
+			
+			FileHandle file = OpenFile(path, FileMode.READ);
+			if (!file)
+				break;
+			
+			string line;
+			int lineIndex = 0;
+			while (FGets(file, line) >= 0)
+			{
+				if (lineIndex++ < offset.Line)
+					continue;
+				
+				// Incomplete last line (still being written): pick it up on the next pass
+				if (line.Length() < 2 || line.Substring(line.Length() - 2, 2) != "|;")
+					break;
+				
+				applied += ApplyLine(line);
+				offset.Line++;
+				advanced = true;
+			}
+			CloseFile(file);
+			
+			// Move to the next segment only once this one is full and its successor exists
+			if (offset.Line < SwarmObserverConstants.CLUSTER_SEGMENT_LINES || !FileExist(GetSegmentPath(serverID, offset.Segment + 1)))
+				break;
+			
+			offset.Segment++;
+			offset.Line = 0;
+		}
+		
+		if (advanced && applied == 0)
+			SaveState();
+		
+		return applied;
+	}
+	
+	// Apply one log line to the local history, returns 1 if it changed anything
+	private int ApplyLine(string line)
+	{
+		array<string> parts = new array<string>;
+		line.Split("|", parts);
+		
+		if (parts.Count() == 7 && parts[0] == "V")
+		{
+			if (SwarmObserverHistory.MergeViolation(parts[1], parts[2], parts[3], parts[4], parts[5]))
+				return 1;
+		}
+		else if (parts.Count() == 4 && parts[0] == "A")
+		{
+			if (SwarmObserverHistory.MergeAcknowledgement(parts[1], parts[2]))
+				return 1;
+		}
+		
+		return 0;
+	}
+	
+	private void AppendLine(string line)
+	{
+		if (m_State.SegmentLines >= SwarmObserverConstants.CLUSTER_SEGMENT_LINES)
+		{
+			m_State.Segment++;
+			m_State.SegmentLines = 0;
+		}
+		
+		FileHandle file = OpenFile(GetSegmentPath(m_ServerID, m_State.Segment), FileMode.APPEND);
+		if (!file)
+		{
+			Print("[SwarmObserver] Failed to append to cluster log: " + GetSegmentPath(m_ServerID, m_State.Segment));
+			return;
+		}
+		
+		FPrintln(file, line);
+		CloseFile(file);
+		
+		m_State.SegmentLines++;
+		SaveState();
+	}
+	
+	private string GetSegmentPath(string serverID, int segment)
+	{
+		return m_Directory + serverID + "\\" + segment.ToStringLen(6) + ".log";
+	}
+	
+	private void LoadState()
+	{
+		if (FileExist(SwarmObserverConstants.FILE_CLUSTER_STATE))
+			JsonFileLoader<SwarmObserverClusterState>.JsonLoadFile(SwarmObserverConstants.FILE_CLUSTER_STATE, m_State);
+		
+		RecoverOwnLogPosition();
+		
+		m_Offsets.Clear();
+		foreach (SwarmObserverClusterOffset offset : m_State.Offsets)
+		{
+			m_Offsets.Set(offset.ServerID, offset);
+		}
+	}
+	
+	// Never go back behind what this server's own log already contains: if cluster_state.json is missing, corrupt or
+	// stale, reusing a sequence or appending to a segment the other servers already consumed would lose entries
+	private void RecoverOwnLogPosition()
+	{
+		// Highest segment in this server's directory
+		int lastSegment = -1;
+		string fileName;
+		FileAttr fileAttr;
+		FindFileHandle handle = FindFile(m_Directory + m_ServerID + "\\*.log", fileName, fileAttr, 0);
+		if (handle)
+		{
+			bool found = true;
+			while (found)
+			{
+				if (!(fileAttr & FileAttr.DIRECTORY) && fileName.Length() > 4)
+					lastSegment = Math.Max(lastSegment, fileName.Substring(0, fileName.Length() - 4).ToInt());
+				
+				found = FindNextFile(handle, fileName, fileAttr);
+			}
+			CloseFindFile(handle);
+		}
+		
+		if (lastSegment < 0)
+			return;
+		
+		// Walk back from the last segment until one holds a violation of ours (acknowledgement-only segments carry no sequence)
+		string idPrefix = m_ServerID + ":";
+		int lastSequence = 0;
+		int lastSegmentLines = 0;
+		array<string> parts = new array<string>;
+		for (int segment = lastSegment; segment >= 0 && lastSequence == 0; segment--)
+		{
+			FileHandle file = OpenFile(GetSegmentPath(m_ServerID, segment), FileMode.READ);
+			if (!file)
+				continue;
+			
+			string line;
+			int lines = 0;
+			while (FGets(file, line) >= 0)
+			{
+				lines++;
+				
+				parts.Clear();
+				line.Split("|", parts);
+				if (parts.Count() == 7 && parts[0] == "V" && parts[1].IndexOf(idPrefix) == 0)
+					lastSequence = Math.Max(lastSequence, parts[1].Substring(idPrefix.Length(), parts[1].Length() - idPrefix.Length()).ToInt());
+			}
+			CloseFile(file);
+			
+			if (segment == lastSegment)
+				lastSegmentLines = lines;
+		}
+		
+		if (lastSequence > m_State.Sequence)
+		{
+			Print("[SwarmObserver] Cluster sequence recovered from the log: " + m_State.Sequence + " -> " + lastSequence);
+			m_State.Sequence = lastSequence;
+		}
+		
+		if (lastSegment > m_State.Segment || (lastSegment == m_State.Segment && lastSegmentLines > m_State.SegmentLines))
+		{
+			Print("[SwarmObserver] Cluster segment recovered from the log: " + m_State.Segment + " -> " + lastSegment + " (" + lastSegmentLines + " lines)");
+			m_State.Segment = lastSegment;
+			m_State.SegmentLines = lastSegmentLines;
+		}
+	}
+	
+	private void SaveState()
+	{
+		JsonFileLoader<SwarmObserverClusterState>.JsonSaveFile(SwarmObserverConstants.FILE_CLUSTER_STATE, m_State);
+	}
+	
+	// Keep separators and line breaks out of log fields
+	private static string Sanitize(string value)
+	{
+		value.Replace("|", "/");
+		value.Replace("\n", " ");
+		value.Replace("\r", " ");
+		return value;
+	}
+}
+#endif
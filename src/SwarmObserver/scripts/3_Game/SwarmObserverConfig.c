@@ -15,8 +15,22 @@ class SwarmObserverRestrictedArea
 	// Check if a position is within this restricted area
 	bool IsPositionInside(vector pos)
 	{
-		float distance = vector.Distance(pos, Position);
-		return distance <= Radius;
+		return vector.DistanceSq(pos, Position) <= Radius * Radius;
+	}
+}
+
+// Per-ammo shot radius override (radius values <= 0 fall back to the derived radius)
+class SwarmObserverShotRadiusOverride
+{
+	string AmmoType;
+	float Radius;
+	float SuppressedRadius;
+	
+	void SwarmObserverShotRadiusOverride(string ammoType, float radius, float suppressedRadius)
+	{
+		AmmoType = ammoType;
+		Radius = radius;
+		SuppressedRadius = suppressedRadius;
 	}
 }
 
@@ -30,28 +44,64 @@ class SwarmObserverSettings
 	int HistoryDays;
 	autoptr array<ref SwarmObserverRestrictedArea> RestrictedAreas;
 	
+	// Cluster mode: share violation history with other servers through a common directory (needs a restart)
+	bool ClusterEnabled;
+	string ClusterDirectory;
+	string ServerID;
+	int ClusterMergeIntervalSeconds;
+	
 	// Combat logout settings
 	bool CombatLogoutEnabled;
 	int CombatDurationSeconds;
+	int CombatLogoutGraceSeconds;
+	int CombatLogoutDedupeSeconds;
 	float ShotProximityRadius;
+	float ShotAudibleFireScale;
+	autoptr array<ref SwarmObserverShotRadiusOverride> ShotRadiusOverrides;
+	float ShotTrajectoryRange;
+	float ShotTrajectoryRadius;
 	float ExplosiveProximityRadius;
+	float ExplosiveHitRangeScale;
 	string CombatWebhookURL;
 	bool CombatDebugMode;
 	
+	// In-memory store caps (oldest entries are evicted first once a cap is reached)
+	int MaxHistoryRecords;
+	int MaxGracePeriods;
+	int MaxCombatStates;
+	int MaxLogoutData;
+	
 	void SwarmObserverSettings()
 	{
 		RestrictedAreas = new array<ref SwarmObserverRestrictedArea>;
+		ShotRadiusOverrides = new array<ref SwarmObserverShotRadiusOverride>;
 		GracePeriodSeconds = SwarmObserverConstants.DEFAULT_GRACE_PERIOD_SECONDS;
 		HistoryDays = SwarmObserverConstants.DEFAULT_HISTORY_DAYS;
 		WebhookURL = "";
+		ClusterEnabled = false;
+		ClusterDirectory = "";
+		ServerID = "";
+		ClusterMergeIntervalSeconds = SwarmObserverConstants.DEFAULT_CLUSTER_MERGE_INTERVAL_SECONDS;
 		
 		// Combat logout defaults
 		CombatLogoutEnabled = true;
 		CombatDurationSeconds = SwarmObserverConstants.DEFAULT_COMBAT_DURATION_SECONDS;
+		CombatLogoutGraceSeconds = SwarmObserverConstants.DEFAULT_COMBAT_LOGOUT_GRACE_SECONDS;
+		CombatLogoutDedupeSeconds = SwarmObserverConstants.DEFAULT_COMBAT_LOGOUT_DEDUPE_SECONDS;
 		ShotProximityRadius = SwarmObserverConstants.DEFAULT_SHOT_PROXIMITY_RADIUS;
+		ShotAudibleFireScale = SwarmObserverConstants.DEFAULT_SHOT_AUDIBLE_FIRE_SCALE;
+		ShotTrajectoryRange = SwarmObserverConstants.DEFAULT_SHOT_TRAJECTORY_RANGE;
+		ShotTrajectoryRadius = SwarmObserverConstants.DEFAULT_SHOT_TRAJECTORY_RADIUS;
 		ExplosiveProximityRadius = SwarmObserverConstants.DEFAULT_EXPLOSIVE_PROXIMITY_RADIUS;
+		ExplosiveHitRangeScale = SwarmObserverConstants.DEFAULT_EXPLOSIVE_HIT_RANGE_SCALE;
 		CombatWebhookURL = "";
 		CombatDebugMode = false;
+		
+		// Store caps
+		MaxHistoryRecords = SwarmObserverConstants.DEFAULT_MAX_HISTORY_RECORDS;
+		MaxGracePeriods = SwarmObserverConstants.DEFAULT_MAX_GRACE_PERIODS;
+		MaxCombatStates = SwarmObserverConstants.DEFAULT_MAX_COMBAT_STATES;
+		MaxLogoutData = SwarmObserverConstants.DEFAULT_MAX_LOGOUT_DATA;
 	}
 	
 	// Get singleton instance
@@ -76,6 +126,7 @@ class SwarmObserverSettings
 			Print("[SwarmObserver] Webhook URL: " + settings.WebhookURL);
 			Print("[SwarmObserver] Grace Period: " + settings.GracePeriodSeconds + " seconds");
 			Print("[SwarmObserver] History Days: " + settings.HistoryDays);
+			Print("[SwarmObserver] Cluster Enabled: " + settings.ClusterEnabled + " (server: " + settings.ServerID + ")");
 			Print("[SwarmObserver] Restricted Areas: " + settings.RestrictedAreas.Count());
 			
 			foreach (SwarmObserverRestrictedArea area : settings.RestrictedAreas)
@@ -85,9 +136,12 @@ class SwarmObserverSettings
 			
 			Print("[SwarmObserver] Combat Logout Enabled: " + settings.CombatLogoutEnabled);
 			Print("[SwarmObserver] Combat Duration: " + settings.CombatDurationSeconds + " seconds");
-			Print("[SwarmObserver] Shot Proximity Radius: " + settings.ShotProximityRadius + "m");
-			Print("[SwarmObserver] Explosive Proximity Radius: " + settings.ExplosiveProximityRadius + "m");
+			Print("[SwarmObserver] Combat Logout Grace: " + settings.CombatLogoutGraceSeconds + " seconds (dedupe window: " + settings.CombatLogoutDedupeSeconds + " seconds)");
+			Print("[SwarmObserver] Shot Proximity Radius: " + settings.ShotProximityRadius + "m (audibleFire scale: " + settings.ShotAudibleFireScale + ", overrides: " + settings.ShotRadiusOverrides.Count() + ")");
+			Print("[SwarmObserver] Shot Trajectory: " + settings.ShotTrajectoryRange + "m range, " + settings.ShotTrajectoryRadius + "m radius");
+			Print("[SwarmObserver] Explosive Proximity Radius: " + settings.ExplosiveProximityRadius + "m (indirectHitRange scale: " + settings.ExplosiveHitRangeScale + ")");
 			Print("[SwarmObserver] Combat Debug Mode: " + settings.CombatDebugMode);
+			Print("[SwarmObserver] Store caps: " + settings.MaxHistoryRecords + " history records, " + settings.MaxGracePeriods + " grace periods, " + settings.MaxCombatStates + " combat states, " + settings.MaxLogoutData + " logout entries");
 		}
 		else
 		{
@@ -96,9 +150,154 @@ class SwarmObserverSettings
 			settings.Save();
 		}
 		
+		SwarmObserverSettingsSnapshot.Publish(new SwarmObserverSettingsSnapshot(settings));
+		
+		return true;
+	}
+	
+	// Reload configuration at runtime
+	// The file is loaded into a fresh instance and only swapped in (with a new snapshot) if it validates
+	static bool ReloadConfig()
+	{
+		if (!FileExist(SwarmObserverConstants.FILE_CONFIG))
+		{
+			Print("[SwarmObserver] Config reload skipped: config file not found");
+			return false;
+		}
+		
+		// Parse through JsonSerializer so malformed JSON is reported, JsonFileLoader would leave a default instance
+		// (no restricted areas) that passes validation and silently turns enforcement off
+		SwarmObserverSettings candidate = new SwarmObserverSettings();
+		string parseError;
+		if (!ReadSettingsFile(SwarmObserverConstants.FILE_CONFIG, candidate, parseError))
+		{
+			Print("[SwarmObserver] Config reload rejected, keeping current settings: " + parseError);
+			return false;
+		}
+		
+		array<string> errors = new array<string>;
+		if (!candidate.Validate(errors))
+		{
+			Print("[SwarmObserver] Config reload rejected, keeping current settings:");
+			foreach (string error : errors)
+			{
+				Print("[SwarmObserver]   - " + error);
+			}
+			return false;
+		}
+		
+		s_Instance = candidate;
+		SwarmObserverSettingsSnapshot.Publish(new SwarmObserverSettingsSnapshot(candidate));
+		
+		Print("[SwarmObserver] Config reloaded (" + candidate.RestrictedAreas.Count() + " restricted areas, combat logout: " + candidate.CombatLogoutEnabled + ")");
+		return true;
+	}
+	
+	// Read and parse the whole config file, false with an error message if it cannot be read or is not valid JSON
+	private static bool ReadSettingsFile(string path, SwarmObserverSettings settings, out string error)
+	{
+		FileHandle file = OpenFile(path, FileMode.READ);
+		if (!file)
+		{
+			error = "cannot open " + path;
+			return false;
+		}
+		
+		string content = "";
+		string line;
+		while (FGets(file, line) >= 0)
+		{
+			content += line + "\n";
+		}
+		CloseFile(file);
+		
+		JsonSerializer serializer = new JsonSerializer();
+		if (!serializer.ReadFromString(settings, content, error))
+		{
+			if (error == "")
+				error = "invalid JSON in " + path;
+			return false;
+		}
 		return true;
 	}
 	
+	// Validate settings values, collecting a message for each problem
+	bool Validate(array<string> errors)
+	{
+		if (GracePeriodSeconds < 0)
+			errors.Insert("GracePeriodSeconds must not be negative");
+		
+		if (HistoryDays < 0)
+			errors.Insert("HistoryDays must not be negative");
+		
+		if (ClusterEnabled)
+		{
+			if (ServerID == "" || ServerID.Contains("|") || ServerID.Contains(":") || ServerID.Contains("\\") || ServerID.Contains("/"))
+				errors.Insert("ServerID must be set and must not contain | : \\ or / when ClusterEnabled is true");
+			
+			if (ClusterMergeIntervalSeconds <= 0)
+				errors.Insert("ClusterMergeIntervalSeconds must be greater than 0");
+		}
+		
+		if (CombatDurationSeconds <= 0)
+			errors.Insert("CombatDurationSeconds must be greater than 0");
+		
+		if (CombatLogoutGraceSeconds < 0)
+			errors.Insert("CombatLogoutGraceSeconds must not be negative");
+		
+		if (CombatLogoutDedupeSeconds < 0)
+			errors.Insert("CombatLogoutDedupeSeconds must not be negative");
+		
+		if (ShotProximityRadius < 0 || ShotProximityRadius > SwarmObserverConstants.MAX_PROXIMITY_RADIUS)
+			errors.Insert("ShotProximityRadius must be between 0 and " + SwarmObserverConstants.MAX_PROXIMITY_RADIUS);
+		
+		if (ShotTrajectoryRange < 0 || ShotTrajectoryRange > SwarmObserverConstants.MAX_PROXIMITY_RADIUS)
+			errors.Insert("ShotTrajectoryRange must be between 0 and " + SwarmObserverConstants.MAX_PROXIMITY_RADIUS);
+		
+		if (ShotTrajectoryRadius < 0)
+			errors.Insert("ShotTrajectoryRadius must not be negative");
+		
+		if (ShotAudibleFireScale < 0)
+			errors.Insert("ShotAudibleFireScale must not be negative");
+		
+		if (ShotRadiusOverrides)
+		{
+			foreach (SwarmObserverShotRadiusOverride shotOverride : ShotRadiusOverrides)
+			{
+				if (!shotOverride || shotOverride.AmmoType == "")
+					errors.Insert("Shot radius override without an ammo type");
+				else if (shotOverride.Radius > SwarmObserverConstants.MAX_PROXIMITY_RADIUS || shotOverride.SuppressedRadius > SwarmObserverConstants.MAX_PROXIMITY_RADIUS)
+					errors.Insert("Shot radius override " + shotOverride.AmmoType + " must not exceed " + SwarmObserverConstants.MAX_PROXIMITY_RADIUS);
+			}
+		}
+		
+		if (ExplosiveProximityRadius < 0 || ExplosiveProximityRadius > SwarmObserverConstants.MAX_PROXIMITY_RADIUS)
+			errors.Insert("ExplosiveProximityRadius must be between 0 and " + SwarmObserverConstants.MAX_PROXIMITY_RADIUS);
+		
+		if (ExplosiveHitRangeScale < 0)
+			errors.Insert("ExplosiveHitRangeScale must not be negative");
+		
+		if (MaxHistoryRecords <= 0 || MaxGracePeriods <= 0 || MaxCombatStates <= 0 || MaxLogoutData <= 0)
+			errors.Insert("MaxHistoryRecords, MaxGracePeriods, MaxCombatStates and MaxLogoutData must be greater than 0");
+		
+		if (!RestrictedAreas)
+		{
+			errors.Insert("RestrictedAreas is missing");
+		}
+		else
+		{
+			foreach (SwarmObserverRestrictedArea area : RestrictedAreas)
+			{
+				if (!area || area.Name == "")
+					errors.Insert("Restricted area without a name");
+				else if (area.Radius <= 0)
+					errors.Insert("Restricted area " + area.Name + " must have a radius greater than 0");
+			}
+		}
+		
+		return errors.Count() == 0;
+	}
+	
 	// Save configuration to file
 	void Save()
 	{
@@ -113,29 +312,44 @@ class SwarmObserverSettings
 		GracePeriodSeconds = SwarmObserverConstants.DEFAULT_GRACE_PERIOD_SECONDS;
 		HistoryDays = SwarmObserverConstants.DEFAULT_HISTORY_DAYS;
 		
+		ClusterEnabled = false;
+		ClusterDirectory = "";
+		ServerID = "";
+		ClusterMergeIntervalSeconds = SwarmObserverConstants.DEFAULT_CLUSTER_MERGE_INTERVAL_SECONDS;
+		
 		RestrictedAreas.Clear();
 		RestrictedAreas.Insert(new SwarmObserverRestrictedArea("Athena-3", Vector(3592, 120, 6709), 80));
 		
 		// Combat logout defaults
 		CombatLogoutEnabled = true;
 		CombatDurationSeconds = SwarmObserverConstants.DEFAULT_COMBAT_DURATION_SECONDS;
+		CombatLogoutGraceSeconds = SwarmObserverConstants.DEFAULT_COMBAT_LOGOUT_GRACE_SECONDS;
+		CombatLogoutDedupeSeconds = SwarmObserverConstants.DEFAULT_COMBAT_LOGOUT_DEDUPE_SECONDS;
 		ShotProximityRadius = SwarmObserverConstants.DEFAULT_SHOT_PROXIMITY_RADIUS;
+		ShotAudibleFireScale = SwarmObserverConstants.DEFAULT_SHOT_AUDIBLE_FIRE_SCALE;
+		ShotTrajectoryRange = SwarmObserverConstants.DEFAULT_SHOT_TRAJECTORY_RANGE;
+		ShotTrajectoryRadius = SwarmObserverConstants.DEFAULT_SHOT_TRAJECTORY_RADIUS;
 		ExplosiveProximityRadius = SwarmObserverConstants.DEFAULT_EXPLOSIVE_PROXIMITY_RADIUS;
+		ExplosiveHitRangeScale = SwarmObserverConstants.DEFAULT_EXPLOSIVE_HIT_RANGE_SCALE;
 		CombatWebhookURL = "";
 		CombatDebugMode = false;
+		
+		MaxHistoryRecords = SwarmObserverConstants.DEFAULT_MAX_HISTORY_RECORDS;
+		MaxGracePeriods = SwarmObserverConstants.DEFAULT_MAX_GRACE_PERIODS;
+		MaxCombatStates = SwarmObserverConstants.DEFAULT_MAX_COMBAT_STATES;
+		MaxLogoutData = SwarmObserverConstants.DEFAULT_MAX_LOGOUT_DATA;
+		
+		ShotRadiusOverrides.Clear();
+		ShotRadiusOverrides.Insert(new SwarmObserverShotRadiusOverride("Bullet_22", 15, 5));
 	}
 	
-	// Check if a position is in any restricted area
+	// Check if a position is in any restricted area (uses the snapshot zone index)
 	static SwarmObserverRestrictedArea GetRestrictedAreaAtPosition(vector pos)
 	{
-		SwarmObserverSettings settings = GetInstance();
-		
-		foreach (SwarmObserverRestrictedArea area : settings.RestrictedAreas)
+		SwarmObserverZone zone = SwarmObserverSettingsSnapshot.Get().FindZone(pos);
+		if (zone)
 		{
-			if (area.IsPositionInside(pos))
-			{
-				return area;
-			}
+			return zone.Area;
 		}
 		
 		return null;
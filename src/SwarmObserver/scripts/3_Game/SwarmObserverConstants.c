@@ -8,6 +8,25 @@ class SwarmObserverConstants
 	static const string FILE_CONFIG = DIR_SWARM_OBSERVER + "config.json";
 	static const string FILE_HISTORY = DIR_SWARM_OBSERVER + "history.json";
 	
+	// Creating this file makes the server reload config.json (the file is deleted once handled)
+	static const string FILE_RELOAD_TRIGGER = DIR_SWARM_OBSERVER + "reload";
+	
+	// Cluster mode (shared history between servers)
+	static const string DIR_CLUSTER_DEFAULT = DIR_SWARM_OBSERVER + "cluster\\";
+	static const string FILE_CLUSTER_STATE = DIR_SWARM_OBSERVER + "cluster_state.json";
+	static const int CLUSTER_SEGMENT_LINES = 1000;
+	static const int DEFAULT_CLUSTER_MERGE_INTERVAL_SECONDS = 30;
+	
+	// Admin history queries
+	static const int HISTORY_QUERY_DEFAULT_PAGE_SIZE = 20;
+	static const int HISTORY_QUERY_MAX_PAGE_SIZE = 50;
+	static const int HISTORY_QUERY_SCAN_LIMIT = 5000; // Violations examined per page before handing back a cursor
+	
+	// Warm restart snapshot (written on shutdown, consumed on the next start)
+	static const string FILE_WARM_STATE = DIR_SWARM_OBSERVER + "warmstate.bin";
+	static const int WARM_STATE_VERSION = 2;
+	static const int WARM_STATE_MAX_AGE_SECONDS = 3600;
+	
 	// File extensions
 	static const string EXT_JSON = ".json";
 	
@@ -18,10 +37,72 @@ class SwarmObserverConstants
 	
 	// Combat logout settings
 	static const int DEFAULT_COMBAT_DURATION_SECONDS = 300;
+	static const int DEFAULT_COMBAT_LOGOUT_GRACE_SECONDS = 30;
+	static const int DEFAULT_COMBAT_LOGOUT_DEDUPE_SECONDS = 600;
+	static const int COMBAT_LOGOUT_GRACE_POLL_MS = 5000;
 	static const float DEFAULT_SHOT_PROXIMITY_RADIUS = 50.0;
 	static const float DEFAULT_EXPLOSIVE_PROXIMITY_RADIUS = 30.0;
+	static const float DEFAULT_EXPLOSIVE_HIT_RANGE_SCALE = 3.0;
 	static const int COMBAT_CLEANUP_INTERVAL_MS = 30000;
 	static const int MAX_COMBAT_ACTIONS_STORED = 20;
+	static const float MAX_PROXIMITY_RADIUS = 1000.0;
+	
+	// Combat position trail (ring of quantized samples per player in combat)
+	static const int COMBAT_TRAIL_SIZE = 32;
+	static const float COMBAT_TRAIL_QUANTIZATION = 0.5; // meters per 16-bit step (covers 0-32767m)
+	static const int COMBAT_TRAIL_SAMPLE_INTERVAL_MS = 500;
+	static const int COMBAT_TRAIL_SAMPLES_PER_TICK = 8; // players sampled per tick, round-robin
+	static const int COMBAT_TRAIL_WEBHOOK_POINTS = 12;
+	
+	// Shot radius derived from CfgAmmo audibleFire (meters per audibleFire unit, capped at ShotProximityRadius)
+	static const float DEFAULT_SHOT_AUDIBLE_FIRE_SCALE = 10.0;
+	
+	// Shot trajectory capsule (players within the radius of the bullet path are shot at)
+	// The length is per ammo: the distance at which CfgAmmo airFriction has slowed the bullet to this fraction of
+	// its speed, capped at ShotTrajectoryRange (which is also used for ammo without airFriction)
+	static const float DEFAULT_SHOT_TRAJECTORY_RANGE = 300.0;
+	static const float DEFAULT_SHOT_TRAJECTORY_RADIUS = 5.0;
+	static const float SHOT_TRAJECTORY_SPEED_FRACTION = 0.5;
+	
+	// Connected player grid used by combat queries
+	static const float PLAYER_INDEX_CELL_SIZE = 64.0;
+	static const float PLAYER_INDEX_MARGIN = 10.0;
+	static const int PLAYER_INDEX_REFRESH_MS = 1000;
+	
+	// Runtime config reload
+	static const int CONFIG_RELOAD_POLL_MS = 5000;
+	
+	// Creating this file makes the server log a memory report of its in-memory stores (the file is deleted once handled)
+	static const string FILE_MEMORY_REPORT_TRIGGER = DIR_SWARM_OBSERVER + "memreport";
+	
+	// In-memory store caps
+	static const int DEFAULT_MAX_HISTORY_RECORDS = 20000;
+	static const int DEFAULT_MAX_GRACE_PERIODS = 1000;
+	static const int DEFAULT_MAX_COMBAT_STATES = 1000;
+	static const int DEFAULT_MAX_LOGOUT_DATA = 1000;
+	static const float HISTORY_EVICTION_RATIO = 0.9; // History evicts down to this share of the cap, so the scan runs once per batch
+	
+	// Memory estimates (bytes): per object/container slot, per string on top of its characters
+	static const int MEMORY_OBJECT_BYTES = 48;
+	static const int MEMORY_STRING_BYTES = 16;
+	
+	// Synthetic load benchmark (started by the -swarmObserverBenchmark[=players] launch parameter)
+	static const string CLI_BENCHMARK = "swarmObserverBenchmark";
+	static const string FILE_BENCHMARK_CONFIG = DIR_SWARM_OBSERVER + "benchmark.json";
+	static const string FILE_BENCHMARK_REPORT_PREFIX = DIR_SWARM_OBSERVER + "benchmark_";
+	static const int BENCHMARK_TICK_MS = 100; // Also the full-auto interval: one round per shooter per tick (600 rpm)
+	static const int BENCHMARK_SPAWN_BATCH = 25; // Dummy players spawned per tick
+	
+	// History store benchmark (started by the -swarmObserverHistoryBenchmark[=sizes] launch parameter)
+	static const string CLI_HISTORY_BENCHMARK = "swarmObserverHistoryBenchmark";
+	static const string FILE_HISTORY_BENCHMARK = DIR_SWARM_OBSERVER + "history_benchmark.json"; // Scratch dataset
+	static const string FILE_HISTORY_BENCHMARK_REPORT_PREFIX = DIR_SWARM_OBSERVER + "history_benchmark_";
+	static const int HISTORY_BENCHMARK_STEP_MS = 1000; // Pause between dataset sizes
+	static const float HISTORY_BENCHMARK_SKEW = 1.5; // Pareto exponent of the violation counts
+	static const int HISTORY_BENCHMARK_MAX_VIOLATIONS = 50;
+	
+	// Restricted area zone index cell size (meters)
+	static const float ZONE_INDEX_CELL_SIZE = 256.0;
 	
 	// Menu IDs
 	static const int MENU_SWARM_OBSERVER_WARNING = 28501;
@@ -1,3 +1,4 @@
+#ifndef SWARM_OBSERVER_NO_ZONES
 // Grace period data for a player
 class SwarmObserverGracePeriodData
 {
@@ -42,7 +43,10 @@ class SwarmObserverGracePeriodManager
 	static void StartGracePeriod(string steamID, string playerName, string areaName)
 	{
 		SwarmObserverGracePeriodManager manager = GetInstance();
-		SwarmObserverSettings settings = SwarmObserverSettings.GetInstance();
+		
+		// At the cap, the oldest grace period (closest to its deadline) stops being tracked
+		if (!manager.m_ActiveGracePeriods.Contains(steamID) && manager.m_ActiveGracePeriods.Count() >= SwarmObserverSettingsSnapshot.Get().MaxGracePeriods)
+			manager.DropOldestGracePeriod();
 		
 		// Create grace period data
 		SwarmObserverGracePeriodData data = new SwarmObserverGracePeriodData(steamID, playerName, areaName);
@@ -59,12 +63,76 @@ class SwarmObserverGracePeriodManager
 		}
 	}
 	
+	// Restore a grace period from the warm restart snapshot (disconnectTimestamp already rebased to this run)
+	static void RestoreGracePeriod(string steamID, string playerName, string areaName, int disconnectTimestamp)
+	{
+		SwarmObserverGracePeriodManager manager = GetInstance();
+		
+		SwarmObserverGracePeriodData data = new SwarmObserverGracePeriodData(steamID, playerName, areaName);
+		data.DisconnectTimestamp = disconnectTimestamp;
+		manager.m_ActiveGracePeriods.Set(steamID, data);
+		
+		if (!manager.m_TimerRunning)
+		{
+			manager.m_TimerRunning = true;
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(manager.CheckExpiredGracePeriods, 5000, true);
+		}
+	}
+	
+	// Drop the oldest grace period (cap reached). The player is still inside their grace window, so no violation is
+	// recorded and no webhook is sent, they simply are not tracked any more.
+	private void DropOldestGracePeriod()
+	{
+		string oldestSteamID;
+		int oldestTimestamp = int.MAX;
+		foreach (string steamID, SwarmObserverGracePeriodData data : m_ActiveGracePeriods)
+		{
+			if (data.DisconnectTimestamp < oldestTimestamp)
+			{
+				oldestTimestamp = data.DisconnectTimestamp;
+				oldestSteamID = steamID;
+			}
+		}
+		
+		if (oldestSteamID == "")
+			return;
+		
+		SwarmObserverGracePeriodData oldest = m_ActiveGracePeriods.Get(oldestSteamID);
+		Print("[SwarmObserver] Grace period cap reached (" + m_ActiveGracePeriods.Count() + "), dropping oldest without a violation: " + oldest.PlayerName + " (" + oldestSteamID + ", " + oldest.AreaName + ")");
+		m_ActiveGracePeriods.Remove(oldestSteamID);
+	}
+	
+	// Estimated memory use of the active grace periods
+	static int GetEstimatedBytes()
+	{
+		int bytes = 0;
+		foreach (string steamID, SwarmObserverGracePeriodData data : GetInstance().m_ActiveGracePeriods)
+		{
+			bytes += 2 * SwarmObserverConstants.MEMORY_OBJECT_BYTES + 2 * SwarmObserverMemoryReport.StringBytes(steamID) + SwarmObserverMemoryReport.StringBytes(data.PlayerName) + SwarmObserverMemoryReport.StringBytes(data.AreaName);
+		}
+		return bytes;
+	}
+	
+	// Add active grace periods to the warm restart snapshot
+	static void ExportWarmState(SwarmObserverWarmState warmState)
+	{
+		int currentTime = GetGame().GetTime();
+		foreach (string steamID, SwarmObserverGracePeriodData data : GetInstance().m_ActiveGracePeriods)
+		{
+			SwarmObserverWarmGrace grace = new SwarmObserverWarmGrace();
+			grace.SteamID = steamID;
+			grace.PlayerName = data.PlayerName;
+			grace.AreaName = data.AreaName;
+			grace.DisconnectAgeMs = currentTime - data.DisconnectTimestamp;
+			warmState.GracePeriods.Insert(grace);
+		}
+	}
+	
 	// Check all grace periods and handle expired ones
 	void CheckExpiredGracePeriods()
 	{
 		int currentTime = GetGame().GetTime();
-		SwarmObserverSettings settings = SwarmObserverSettings.GetInstance();
-		int graceTimeMS = settings.GracePeriodSeconds * 1000;
+		int graceTimeMS = SwarmObserverSettingsSnapshot.Get().GracePeriodMs;
 		
 		array<string> expiredPlayers = new array<string>;
 		
@@ -133,6 +201,12 @@ class SwarmObserverGracePeriodManager
 		return false;
 	}
 	
+	// Active grace periods by Steam ID (read only, for admin tools)
+	static map<string, ref SwarmObserverGracePeriodData> GetActiveGracePeriods()
+	{
+		return GetInstance().m_ActiveGracePeriods;
+	}
+	
 	// Check if player has active grace period
 	static bool HasActiveGracePeriod(string steamID)
 	{
@@ -166,3 +240,4 @@ class SwarmObserverGracePeriodManager
 		return 0;
 	}
 }
+#endif
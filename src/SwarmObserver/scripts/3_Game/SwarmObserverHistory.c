@@ -1,11 +1,14 @@
+#ifndef SWARM_OBSERVER_NO_ZONES
 // Individual violation record
 class SwarmObserverViolation
 {
+	string ID; // "<ServerID>:<sequence>" in cluster mode, empty otherwise
 	string AreaName;
 	string Timestamp;
 	
-	void SwarmObserverViolation(string areaName = "", string timestamp = "")
+	void SwarmObserverViolation(string areaName = "", string timestamp = "", string id = "")
 	{
+		ID = id;
 		AreaName = areaName;
 		Timestamp = timestamp;
 	}
@@ -44,10 +47,44 @@ class SwarmObserverPlayerRecord
 	}
 	
 	// Add violation
-	void AddViolation(string areaName, string timestamp)
+	SwarmObserverViolation AddViolation(string areaName, string timestamp, string id = "")
 	{
-		SwarmObserverViolation violation = new SwarmObserverViolation(areaName, timestamp);
+		SwarmObserverViolation violation = new SwarmObserverViolation(areaName, timestamp, id);
 		Violations.Insert(violation);
+		return violation;
+	}
+	
+	// Sort key ("yyyymmddhhmmss") of the most recent violation, used for oldest-first eviction
+	string GetLastSortKey()
+	{
+		string lastKey = "";
+		foreach (SwarmObserverViolation violation : Violations)
+		{
+			string sortKey = SwarmObserverHistoryIndex.ToSortKey(violation.Timestamp, false);
+			if (sortKey > lastKey)
+				lastKey = sortKey;
+		}
+		return lastKey;
+	}
+	
+	// Estimated memory use of this record, its violations and their index entries
+	int GetEstimatedBytes()
+	{
+		int bytes = 2 * SwarmObserverConstants.MEMORY_OBJECT_BYTES + 2 * SwarmObserverMemoryReport.StringBytes(SteamID) + SwarmObserverMemoryReport.StringBytes(PlayerName) + SwarmObserverMemoryReport.StringBytes(LastAcknowledgedTimestamp);
+		foreach (SwarmObserverViolation violation : Violations)
+		{
+			int violationBytes = SwarmObserverConstants.MEMORY_OBJECT_BYTES + SwarmObserverMemoryReport.StringBytes(violation.ID) + SwarmObserverMemoryReport.StringBytes(violation.AreaName) + SwarmObserverMemoryReport.StringBytes(violation.Timestamp);
+			
+			// Index entry (copies of the strings plus a sort key and day) and its three bucket slots
+			int indexBytes = SwarmObserverConstants.MEMORY_OBJECT_BYTES + SwarmObserverMemoryReport.StringBytes(SteamID) + SwarmObserverMemoryReport.StringBytes(violation.AreaName) + 2 * SwarmObserverMemoryReport.StringBytes(violation.Timestamp) + 16;
+			
+			bytes += violationBytes + indexBytes;
+			
+			// Cluster ID set
+			if (violation.ID != "")
+				bytes += SwarmObserverMemoryReport.StringBytes(violation.ID);
+		}
+		return bytes;
 	}
 	
 	// Get violation count
@@ -94,6 +131,9 @@ class SwarmObserverPlayerRecord
 		GetYearMonthDay(year, month, day);
 		GetHourMinuteSecond(hour, minute, second);
 		LastAcknowledgedTimestamp = FormatTwoDigits(day) + "/" + FormatTwoDigits(month) + "/" + year.ToString() + " " + FormatTwoDigits(hour) + ":" + FormatTwoDigits(minute) + ":" + FormatTwoDigits(second);
+		
+		// Let the other servers of the cluster know
+		SwarmObserverCluster.GetInstance().AppendAcknowledgement(SteamID, LastAcknowledgedTimestamp);
 	}
 }
 
@@ -113,10 +153,16 @@ class SwarmObserverHistory
 {
 	private static ref SwarmObserverHistory s_Instance;
 	private ref map<string, ref SwarmObserverPlayerRecord> m_Records;
+	private ref set<string> m_ViolationIDs; // Cluster IDs already in the history (makes merges idempotent)
+	private ref SwarmObserverHistoryIndex m_Index; // Area / day / Steam ID indexes for admin queries
+	private string m_FilePath;
 	
 	void SwarmObserverHistory()
 	{
+		m_FilePath = SwarmObserverConstants.FILE_HISTORY;
 		m_Records = new map<string, ref SwarmObserverPlayerRecord>;
+		m_ViolationIDs = new set<string>;
+		m_Index = new SwarmObserverHistoryIndex();
 	}
 	
 	// Get singleton instance
@@ -129,30 +175,55 @@ class SwarmObserverHistory
 		return s_Instance;
 	}
 	
+	// Storage backend name, recorded with benchmark results
+	static string GetStorageName()
+	{
+		return "json";
+	}
+	
+	// Point load and save at another file (the history benchmark's scratch datasets)
+	static void SetFilePath(string path)
+	{
+		GetInstance().m_FilePath = path;
+	}
+	
 	// Load history from file
 	static bool LoadHistory()
 	{
 		SwarmObserverHistory history = GetInstance();
 		history.m_Records.Clear();
+		history.m_ViolationIDs.Clear();
+		history.m_Index.BeginBulk();
 		
-		if (FileExist(SwarmObserverConstants.FILE_HISTORY))
+		if (FileExist(history.m_FilePath))
 		{
 			SwarmObserverHistoryData data = new SwarmObserverHistoryData();
-			JsonFileLoader<SwarmObserverHistoryData>.JsonLoadFile(SwarmObserverConstants.FILE_HISTORY, data);
+			JsonFileLoader<SwarmObserverHistoryData>.JsonLoadFile(history.m_FilePath, data);
 			
 			// Convert array to map for faster lookups
 			foreach (SwarmObserverPlayerRecord record : data.Players)
 			{
 				history.m_Records.Set(record.SteamID, record);
+				
+				foreach (SwarmObserverViolation violation : record.Violations)
+				{
+					if (violation.ID != "")
+						history.m_ViolationIDs.Insert(violation.ID);
+					
+					history.m_Index.Add(record.SteamID, violation);
+				}
 			}
 			
 			// Clean expired records
 			history.CleanExpiredRecords();
+			history.m_Index.EndBulk();
+			history.EnforceRecordCap();
 			
 			Print("[SwarmObserver] History loaded: " + history.m_Records.Count() + " active records");
 		}
 		else
 		{
+			history.m_Index.EndBulk();
 			Print("[SwarmObserver] History file not found, starting fresh");
 		}
 		
@@ -164,6 +235,10 @@ class SwarmObserverHistory
 	{
 		SwarmObserverHistory history = GetInstance();
 		
+		// Synthetic benchmark violations never reach the real history file
+		if (SwarmObserverBenchmarkSettings.IsActive() && history.m_FilePath == SwarmObserverConstants.FILE_HISTORY)
+			return false;
+		
 		// Convert map to array for serialization
 		SwarmObserverHistoryData data = new SwarmObserverHistoryData();
 		foreach (string steamID, SwarmObserverPlayerRecord record : history.m_Records)
@@ -171,7 +246,7 @@ class SwarmObserverHistory
 			data.Players.Insert(record);
 		}
 		
-		JsonFileLoader<SwarmObserverHistoryData>.JsonSaveFile(SwarmObserverConstants.FILE_HISTORY, data);
+		JsonFileLoader<SwarmObserverHistoryData>.JsonSaveFile(history.m_FilePath, data);
 		Print("[SwarmObserver] History saved: " + history.m_Records.Count() + " records");
 		return true;
 	}
@@ -239,6 +314,7 @@ class SwarmObserverHistory
 		{
 			record = new SwarmObserverPlayerRecord(steamID, playerName);
 			history.m_Records.Set(steamID, record);
+			history.EnforceRecordCap();
 		}
 		
 		// Get current timestamp
@@ -264,7 +340,12 @@ class SwarmObserverHistory
 		
 		string timestamp = dayStr + "/" + monthStr + "/" + year.ToString() + " " + hourStr + ":" + minuteStr + ":" + secondStr;
 		
-		record.AddViolation(areaName, timestamp);
+		// Cluster mode: log it for the other servers and tag it with a cluster-wide ID
+		string id = SwarmObserverCluster.GetInstance().AppendViolation(steamID, playerName, areaName, timestamp);
+		if (id != "")
+			history.m_ViolationIDs.Insert(id);
+		
+		history.m_Index.Add(steamID, record.AddViolation(areaName, timestamp, id));
 		
 		Print("[SwarmObserver] Violation recorded for " + playerName + " (" + steamID + "): " + record.GetCount() + " total");
 		
@@ -272,6 +353,126 @@ class SwarmObserverHistory
 		SaveHistory();
 	}
 	
+	// Merge a violation recorded by another server (returns false if it is already known)
+	// The caller saves the history once per merge pass.
+	static bool MergeViolation(string id, string steamID, string playerName, string areaName, string timestamp)
+	{
+		SwarmObserverHistory history = GetInstance();
+		if (id == "" || history.m_ViolationIDs.Find(id) != -1)
+			return false;
+		
+		SwarmObserverPlayerRecord record;
+		if (!history.m_Records.Find(steamID, record))
+		{
+			record = new SwarmObserverPlayerRecord(steamID, playerName);
+			history.m_Records.Set(steamID, record);
+			history.EnforceRecordCap();
+		}
+		
+		history.m_Index.Add(steamID, record.AddViolation(areaName, timestamp, id));
+		history.m_ViolationIDs.Insert(id);
+		return true;
+	}
+	
+	// Merge an acknowledgement made on another server (returns false if it changes nothing)
+	// Timestamps are "dd/mm/yyyy hh:mm:ss", so they are compared through their sort keys
+	static bool MergeAcknowledgement(string steamID, string timestamp)
+	{
+		SwarmObserverPlayerRecord record;
+		if (!GetInstance().m_Records.Find(steamID, record))
+			return false;
+		
+		string sortKey = SwarmObserverHistoryIndex.ToSortKey(timestamp, false);
+		if (sortKey == "" || sortKey <= SwarmObserverHistoryIndex.ToSortKey(record.LastAcknowledgedTimestamp, false))
+			return false;
+		
+		record.LastAcknowledgedTimestamp = timestamp;
+		return true;
+	}
+	
+	// Run an admin query over the indexed history (only the requested page is built)
+	static SwarmObserverHistoryQueryPage Query(SwarmObserverHistoryQuery query)
+	{
+		SwarmObserverHistory history = GetInstance();
+		return history.m_Index.Query(query, history.m_Records);
+	}
+	
+	// Most recent violations, newest first
+	static void GetRecentViolations(int count, array<SwarmObserverHistoryIndexEntry> results)
+	{
+		GetInstance().m_Index.GetRecent(count, results);
+	}
+	
+	static int GetRecordCount()
+	{
+		return GetInstance().m_Records.Count();
+	}
+	
+	// Estimated memory use of the records, indexes and cluster IDs (walks every record, only for reports)
+	static int GetEstimatedBytes()
+	{
+		int bytes = 0;
+		foreach (string steamID, SwarmObserverPlayerRecord record : GetInstance().m_Records)
+		{
+			bytes += record.GetEstimatedBytes();
+		}
+		return bytes;
+	}
+	
+	// Evict the records whose last violation is the oldest once MaxHistoryRecords is exceeded
+	// Eviction goes down to HISTORY_EVICTION_RATIO of the cap, so the sort and index rebuild run once per batch.
+	// A record just created has no violation yet and sorts last, so it is never evicted.
+	private void EnforceRecordCap()
+	{
+		int cap = SwarmObserverSettingsSnapshot.Get().MaxHistoryRecords;
+		if (m_Records.Count() <= cap)
+			return;
+		
+		int keep = cap * SwarmObserverConstants.HISTORY_EVICTION_RATIO;
+		array<string> order = new array<string>;
+		foreach (string steamID, SwarmObserverPlayerRecord record : m_Records)
+		{
+			string lastKey = record.GetLastSortKey();
+			if (record.Violations.Count() == 0)
+				lastKey = "99999999999999";
+			order.Insert(lastKey + "|" + steamID);
+		}
+		order.Sort();
+		
+		int evictCount = m_Records.Count() - keep;
+		array<string> parts = new array<string>;
+		for (int i = 0; i < evictCount; i++)
+		{
+			parts.Clear();
+			order[i].Split("|", parts);
+			
+			SwarmObserverPlayerRecord evicted;
+			if (!m_Records.Find(parts[1], evicted))
+				continue;
+			
+			foreach (SwarmObserverViolation violation : evicted.Violations)
+			{
+				int idIndex = m_ViolationIDs.Find(violation.ID);
+				if (idIndex != -1)
+					m_ViolationIDs.Remove(idIndex);
+			}
+			m_Records.Remove(parts[1]);
+		}
+		
+		// Rebuild the indexes from the remaining records
+		m_Index.BeginBulk();
+		foreach (string remainingSteamID, SwarmObserverPlayerRecord remaining : m_Records)
+		{
+			foreach (SwarmObserverViolation remainingViolation : remaining.Violations)
+			{
+				m_Index.Add(remainingSteamID, remainingViolation);
+			}
+		}
+		m_Index.EndBulk();
+		
+		Print("[SwarmObserver] History cap reached (" + cap + " records), evicted " + evictCount + " oldest records");
+	}
+	
 	// Remove expired records
 	void CleanExpiredRecords()
 	{
@@ -313,3 +514,4 @@ class SwarmObserverHistory
 		}
 	}
 }
+#endif
@@ -0,0 +1,216 @@
+#ifndef SWARM_OBSERVER_NO_ZONES
+// History store benchmark
+// For each dataset size, writes a synthetic history with skewed violation counts to a scratch file, points
+// SwarmObserverHistory at it and times load, save, lookups and increments through the public API, so whatever
+// storage backend sits behind it is measured the same way. One CSV line per size and operation is written to
+// $profile:SwarmObserver\history_benchmark_<time>.csv; the real history is reloaded once all sizes are done.
+class SwarmObserverHistoryBenchmark
+{
+	private static ref SwarmObserverHistoryBenchmark s_Instance;
+	
+	protected SwarmObserverBenchmarkSettings m_Settings;
+	protected int m_SizeIndex;
+	protected FileHandle m_File;
+	protected string m_Path;
+	protected ref array<string> m_AreaNames;
+	protected SwarmObserverSettings m_RaisedSettings; // Settings whose MaxHistoryRecords the run raised
+	protected int m_OriginalMaxHistoryRecords;
+	
+	void SwarmObserverHistoryBenchmark()
+	{
+		m_Settings = SwarmObserverBenchmarkSettings.GetInstance();
+		m_SizeIndex = 0;
+		
+		// Violations spread over the configured areas, like the real ones
+		m_AreaNames = new array<string>;
+		foreach (SwarmObserverRestrictedArea area : SwarmObserverSettings.GetInstance().RestrictedAreas)
+		{
+			m_AreaNames.Insert(area.Name);
+		}
+		if (m_AreaNames.Count() == 0)
+			m_AreaNames.Insert("Benchmark");
+	}
+	
+	// Start the benchmark if it was requested (called from SwarmObserverModule.Initialize)
+	static void Start()
+	{
+		if (!SwarmObserverBenchmarkSettings.IsHistoryBenchmark() || s_Instance)
+			return;
+		
+		s_Instance = new SwarmObserverHistoryBenchmark();
+		s_Instance.m_Path = SwarmObserverConstants.FILE_HISTORY_BENCHMARK_REPORT_PREFIX + SwarmObserverBenchmarkSettings.GetReportStamp() + ".csv";
+		s_Instance.m_File = OpenFile(s_Instance.m_Path, FileMode.WRITE);
+		if (s_Instance.m_File == 0)
+		{
+			Print("[SwarmObserver] Failed to write history benchmark results: " + s_Instance.m_Path);
+			SwarmObserverBenchmarkSettings.Finished();
+			return;
+		}
+		
+		FPrintln(s_Instance.m_File, "backend,players,violations,operation,calls,total_ms,avg_ms,max_ms");
+		
+		// Each size runs in its own call so the server keeps ticking in between
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(s_Instance.RunNextSize, SwarmObserverConstants.HISTORY_BENCHMARK_STEP_MS, false);
+	}
+	
+	// Benchmark the next dataset size (called by timer)
+	void RunNextSize()
+	{
+		if (m_SizeIndex >= m_Settings.HistorySizes.Count())
+		{
+			Finish();
+			return;
+		}
+		
+		RunSize(m_Settings.HistorySizes[m_SizeIndex]);
+		m_SizeIndex++;
+		
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(RunNextSize, SwarmObserverConstants.HISTORY_BENCHMARK_STEP_MS, false);
+	}
+	
+	protected void RunSize(int players)
+	{
+		Print("[SwarmObserver] History benchmark: " + players + " players");
+		
+		// The store must hold the whole dataset (benchmark runs never save the settings, Finish puts the cap back)
+		SwarmObserverSettings settings = SwarmObserverSettings.GetInstance();
+		if (settings != m_RaisedSettings)
+		{
+			m_RaisedSettings = settings;
+			m_OriginalMaxHistoryRecords = settings.MaxHistoryRecords;
+		}
+		settings.MaxHistoryRecords = Math.Max(settings.MaxHistoryRecords, players + m_Settings.HistoryMutations);
+		SwarmObserverSettingsSnapshot.Publish(new SwarmObserverSettingsSnapshot(settings));
+		
+		int startTicks = TickCount(0);
+		int violations = Generate(players);
+		int ticks = TickCount(startTicks);
+		WriteRow(players, violations, "generate", 1, ticks, ticks);
+		
+		SwarmObserverHistory.SetFilePath(SwarmObserverConstants.FILE_HISTORY_BENCHMARK);
+		
+		startTicks = TickCount(0);
+		SwarmObserverHistory.LoadHistory();
+		ticks = TickCount(startTicks);
+		WriteRow(players, violations, "load", 1, ticks, ticks);
+		
+		startTicks = TickCount(0);
+		SwarmObserverHistory.SaveHistory();
+		ticks = TickCount(startTicks);
+		WriteRow(players, violations, "save", 1, ticks, ticks);
+		
+		// Lookups alternate between known players and players with no record
+		float totalTicks = 0;
+		int maxTicks = 0;
+		for (int i = 0; i < m_Settings.HistoryLookups; i++)
+		{
+			string steamID = GetSyntheticID(Math.RandomInt(0, players));
+			if (i % 2 == 1)
+				steamID = GetSyntheticID(players + i);
+			
+			startTicks = TickCount(0);
+			SwarmObserverHistory.GetPlayerRecord(steamID);
+			ticks = TickCount(startTicks);
+			totalTicks += ticks;
+			maxTicks = Math.Max(maxTicks, ticks);
+		}
+		WriteRow(players, violations, "lookup", m_Settings.HistoryLookups, totalTicks, maxTicks);
+		
+		// Increments include the save that follows every violation
+		totalTicks = 0;
+		maxTicks = 0;
+		for (int j = 0; j < m_Settings.HistoryMutations; j++)
+		{
+			int index = Math.RandomInt(0, players);
+			
+			startTicks = TickCount(0);
+			SwarmObserverHistory.IncrementViolation(GetSyntheticID(index), "Benchmark " + index, m_AreaNames.GetRandomElement());
+			ticks = TickCount(startTicks);
+			totalTicks += ticks;
+			maxTicks = Math.Max(maxTicks, ticks);
+		}
+		WriteRow(players, violations, "increment", m_Settings.HistoryMutations, totalTicks, maxTicks);
+	}
+	
+	// Write a synthetic history of the given size to the scratch file, returns the violation count
+	protected int Generate(int players)
+	{
+		int year, month, day;
+		GetYearMonthDay(year, month, day);
+		
+		SwarmObserverHistoryData data = new SwarmObserverHistoryData();
+		int violations = 0;
+		for (int i = 0; i < players; i++)
+		{
+			SwarmObserverPlayerRecord record = new SwarmObserverPlayerRecord(GetSyntheticID(i), "Benchmark " + i);
+			
+			int count = GetSkewedCount();
+			for (int v = 0; v < count; v++)
+			{
+				record.AddViolation(m_AreaNames.GetRandomElement(), GetRandomTimestamp(year, month, day));
+			}
+			
+			data.Players.Insert(record);
+			violations += count;
+		}
+		
+		JsonFileLoader<SwarmObserverHistoryData>.JsonSaveFile(SwarmObserverConstants.FILE_HISTORY_BENCHMARK, data);
+		return violations;
+	}
+	
+	// Pareto distributed: most players have a single violation, a few have dozens
+	protected static int GetSkewedCount()
+	{
+		float sample = Math.RandomFloat(0.0001, 1);
+		return Math.Min(Math.Floor(Math.Pow(sample, -1 / SwarmObserverConstants.HISTORY_BENCHMARK_SKEW)), SwarmObserverConstants.HISTORY_BENCHMARK_MAX_VIOLATIONS);
+	}
+	
+	// A time earlier this month, in the history timestamp format ("dd/mm/yyyy hh:mm:ss")
+	protected static string GetRandomTimestamp(int year, int month, int today)
+	{
+		int day = Math.RandomIntInclusive(1, today);
+		int hour = Math.RandomInt(0, 24);
+		int minute = Math.RandomInt(0, 60);
+		int second = Math.RandomInt(0, 60);
+		return day.ToStringLen(2) + "/" + month.ToStringLen(2) + "/" + year.ToString() + " " + hour.ToStringLen(2) + ":" + minute.ToStringLen(2) + ":" + second.ToStringLen(2);
+	}
+	
+	// Steam ID shaped key (17 digits)
+	protected static string GetSyntheticID(int index)
+	{
+		return "7656119" + index.ToStringLen(10);
+	}
+	
+	protected void WriteRow(int players, int violations, string operation, int calls, float totalTicks, int maxTicks)
+	{
+		float totalMs = totalTicks / 10000.0;
+		float avgMs = 0;
+		if (calls > 0)
+			avgMs = totalMs / calls;
+		
+		FPrintln(m_File, string.Format("%1,%2,%3,%4,%5,%6,%7,%8", SwarmObserverHistory.GetStorageName(), players, violations, operation, calls, totalMs, avgMs, maxTicks / 10000.0));
+		Print(string.Format("[SwarmObserver]   %1: %2 calls, %3 ms total", operation, calls, totalMs));
+	}
+	
+	// Close the results, drop the scratch dataset and go back to the real history
+	protected void Finish()
+	{
+		CloseFile(m_File);
+		DeleteFile(SwarmObserverConstants.FILE_HISTORY_BENCHMARK);
+		
+		// Put the real cap back before the real history is loaded (a config reload during the run already did)
+		if (m_RaisedSettings && m_RaisedSettings == SwarmObserverSettings.GetInstance())
+		{
+			m_RaisedSettings.MaxHistoryRecords = m_OriginalMaxHistoryRecords;
+			SwarmObserverSettingsSnapshot.Publish(new SwarmObserverSettingsSnapshot(m_RaisedSettings));
+		}
+		m_RaisedSettings = null;
+		
+		SwarmObserverHistory.SetFilePath(SwarmObserverConstants.FILE_HISTORY);
+		SwarmObserverHistory.LoadHistory();
+		
+		Print("[SwarmObserver] History benchmark results written to " + m_Path);
+		SwarmObserverBenchmarkSettings.Finished();
+	}
+}
+#endif
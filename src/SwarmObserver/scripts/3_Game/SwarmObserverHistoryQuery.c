@@ -0,0 +1,559 @@
+#ifndef SWARM_OBSERVER_NO_ZONES
+// History query filters (empty / 0 means no filter)
+class SwarmObserverHistoryQuery
+{
+	string SteamIDPrefix;
+	string AreaName;
+	string From;   // "dd/mm/yyyy" or "dd/mm/yyyy hh:mm:ss", inclusive
+	string To;     // "dd/mm/yyyy" or "dd/mm/yyyy hh:mm:ss", inclusive
+	int MinCount;  // Minimum matching violations per player
+	string Cursor; // NextCursor of the previous page ("" for the first page)
+	int PageSize;
+	
+	void SwarmObserverHistoryQuery()
+	{
+		MinCount = 0;
+		PageSize = SwarmObserverConstants.HISTORY_QUERY_DEFAULT_PAGE_SIZE;
+	}
+	
+	void Write(Serializer ctx)
+	{
+		ctx.Write(SteamIDPrefix);
+		ctx.Write(AreaName);
+		ctx.Write(From);
+		ctx.Write(To);
+		ctx.Write(MinCount);
+		ctx.Write(Cursor);
+		ctx.Write(PageSize);
+	}
+	
+	bool Read(Serializer ctx)
+	{
+		if (!ctx.Read(SteamIDPrefix) || !ctx.Read(AreaName) || !ctx.Read(From) || !ctx.Read(To))
+			return false;
+		
+		return ctx.Read(MinCount) && ctx.Read(Cursor) && ctx.Read(PageSize);
+	}
+}
+
+// One player in a query page (counts only cover the violations matching the filters)
+class SwarmObserverHistoryQueryRow
+{
+	string SteamID;
+	string PlayerName;
+	int Count;
+	string LastAreaName;
+	string LastTimestamp;
+	string LastSortKey; // Not sent, only used while aggregating
+	
+	void Write(Serializer ctx)
+	{
+		ctx.Write(SteamID);
+		ctx.Write(PlayerName);
+		ctx.Write(Count);
+		ctx.Write(LastAreaName);
+		ctx.Write(LastTimestamp);
+	}
+	
+	bool Read(Serializer ctx)
+	{
+		return ctx.Read(SteamID) && ctx.Read(PlayerName) && ctx.Read(Count) && ctx.Read(LastAreaName) && ctx.Read(LastTimestamp);
+	}
+}
+
+// One page of query results, rows sorted by Steam ID
+class SwarmObserverHistoryQueryPage
+{
+	autoptr array<ref SwarmObserverHistoryQueryRow> Rows;
+	string NextCursor; // "" when there is nothing after this page
+	int Scanned;       // Index entries touched to build the page
+	
+	void SwarmObserverHistoryQueryPage()
+	{
+		Rows = new array<ref SwarmObserverHistoryQueryRow>;
+	}
+	
+	void Write(Serializer ctx)
+	{
+		ctx.Write(NextCursor);
+		ctx.Write(Scanned);
+		ctx.Write(Rows.Count());
+		foreach (SwarmObserverHistoryQueryRow row : Rows)
+		{
+			row.Write(ctx);
+		}
+	}
+	
+	bool Read(Serializer ctx)
+	{
+		int rowCount;
+		if (!ctx.Read(NextCursor) || !ctx.Read(Scanned) || !ctx.Read(rowCount))
+			return false;
+		
+		for (int i = 0; i < rowCount; i++)
+		{
+			SwarmObserverHistoryQueryRow row = new SwarmObserverHistoryQueryRow();
+			if (!row.Read(ctx))
+				return false;
+			
+			Rows.Insert(row);
+		}
+		return true;
+	}
+}
+
+// Indexed violation
+class SwarmObserverHistoryIndexEntry
+{
+	string SteamID;
+	string AreaName;
+	string Timestamp;
+	string SortKey; // "yyyymmddhhmmss", compares as a string
+	int Day;        // yyyymmdd bucket
+	
+	void SwarmObserverHistoryIndexEntry(string steamID, string areaName, string timestamp, string sortKey)
+	{
+		SteamID = steamID;
+		AreaName = areaName;
+		Timestamp = timestamp;
+		SortKey = sortKey;
+		Day = SwarmObserverHistoryIndex.GetDay(sortKey);
+	}
+}
+
+// Secondary indexes over the history, maintained on insert
+// Entries are bucketed by area and by day (yyyymmdd), and Steam IDs are kept sorted so a prefix is a binary search.
+// Every bucket is kept sorted by Steam ID, so a cursor is a binary search into the bucket rather than a rescan.
+// A query walks the narrowest of those (prefix range, area bucket or day buckets in range) and never the whole history.
+// Paging is keyset based: the cursor is the last Steam ID examined, so pages stay stable while violations come in.
+// Loads and rebuilds go through BeginBulk / EndBulk: entries are appended and everything is sorted once at the end.
+class SwarmObserverHistoryIndex
+{
+	private ref array<ref SwarmObserverHistoryIndexEntry> m_Entries;
+	private ref map<string, ref array<int>> m_ByArea;    // Entry indexes sorted by Steam ID
+	private ref map<int, ref array<int>> m_ByDay;        // Entry indexes sorted by Steam ID
+	private ref map<string, ref array<int>> m_BySteamID; // Entry indexes in insertion order
+	private ref array<int> m_Days;         // Sorted day bucket keys
+	private ref array<string> m_SteamIDs;  // Sorted Steam IDs with at least one violation
+	private bool m_Bulk;                   // Between BeginBulk and EndBulk, only m_Entries and m_BySteamID are kept
+	
+	void SwarmObserverHistoryIndex()
+	{
+		m_Entries = new array<ref SwarmObserverHistoryIndexEntry>;
+		m_ByArea = new map<string, ref array<int>>;
+		m_ByDay = new map<int, ref array<int>>;
+		m_BySteamID = new map<string, ref array<int>>;
+		m_Days = new array<int>;
+		m_SteamIDs = new array<string>;
+	}
+	
+	void Clear()
+	{
+		m_Entries.Clear();
+		m_ByArea.Clear();
+		m_ByDay.Clear();
+		m_BySteamID.Clear();
+		m_Days.Clear();
+		m_SteamIDs.Clear();
+	}
+	
+	// Clear the index and start a bulk load, Add then only appends until EndBulk
+	void BeginBulk()
+	{
+		Clear();
+		m_Bulk = true;
+	}
+	
+	// Sort the Steam IDs once and rebuild the buckets by walking the players in that order, so every bucket comes
+	// out sorted by Steam ID without a single InsertAt
+	void EndBulk()
+	{
+		m_Bulk = false;
+		m_SteamIDs.Sort();
+		
+		foreach (string steamID : m_SteamIDs)
+		{
+			array<int> playerEntries = m_BySteamID.Get(steamID);
+			foreach (int entryIndex : playerEntries)
+			{
+				SwarmObserverHistoryIndexEntry entry = m_Entries[entryIndex];
+				
+				array<int> areaEntries;
+				if (!m_ByArea.Find(entry.AreaName, areaEntries))
+				{
+					areaEntries = new array<int>;
+					m_ByArea.Set(entry.AreaName, areaEntries);
+				}
+				areaEntries.Insert(entryIndex);
+				
+				array<int> dayEntries;
+				if (!m_ByDay.Find(entry.Day, dayEntries))
+				{
+					dayEntries = new array<int>;
+					m_ByDay.Set(entry.Day, dayEntries);
+					m_Days.Insert(entry.Day);
+				}
+				dayEntries.Insert(entryIndex);
+			}
+		}
+		
+		m_Days.Sort();
+	}
+	
+	int Count()
+	{
+		return m_Entries.Count();
+	}
+	
+	// Newest violations by timestamp, newest first
+	// m_Entries is in load or rebuild order, not time order, so this walks the day buckets from the newest day and
+	// keeps a top-N by SortKey. Older days cannot beat a full result, so the walk stops at the first day after it fills.
+	void GetRecent(int count, array<SwarmObserverHistoryIndexEntry> results)
+	{
+		if (count <= 0)
+			return;
+		
+		for (int d = m_Days.Count() - 1; d >= 0 && results.Count() < count; d--)
+		{
+			array<int> dayEntries = m_ByDay.Get(m_Days[d]);
+			foreach (int entryIndex : dayEntries)
+			{
+				SwarmObserverHistoryIndexEntry entry = m_Entries[entryIndex];
+				
+				// Insertion point among the results, kept newest first
+				int position = results.Count();
+				while (position > 0 && results[position - 1].SortKey < entry.SortKey)
+				{
+					position--;
+				}
+				
+				if (position >= count)
+					continue;
+				
+				results.InsertAt(entry, position);
+				if (results.Count() > count)
+					results.RemoveOrdered(count);
+			}
+		}
+	}
+	
+	// Index a violation (called for every violation added to the history)
+	void Add(string steamID, SwarmObserverViolation violation)
+	{
+		string sortKey = ToSortKey(violation.Timestamp, false);
+		SwarmObserverHistoryIndexEntry entry = new SwarmObserverHistoryIndexEntry(steamID, violation.AreaName, violation.Timestamp, sortKey);
+		int entryIndex = m_Entries.Insert(entry);
+		
+		array<int> playerEntries;
+		bool newPlayer = !m_BySteamID.Find(steamID, playerEntries);
+		if (newPlayer)
+		{
+			playerEntries = new array<int>;
+			m_BySteamID.Set(steamID, playerEntries);
+		}
+		playerEntries.Insert(entryIndex);
+		
+		// Bulk load: EndBulk sorts and builds the buckets once
+		if (m_Bulk)
+		{
+			if (newPlayer)
+				m_SteamIDs.Insert(steamID);
+			return;
+		}
+		
+		array<int> areaEntries;
+		if (!m_ByArea.Find(entry.AreaName, areaEntries))
+		{
+			areaEntries = new array<int>;
+			m_ByArea.Set(entry.AreaName, areaEntries);
+		}
+		areaEntries.InsertAt(entryIndex, UpperBoundEntry(areaEntries, steamID));
+		
+		array<int> dayEntries;
+		if (!m_ByDay.Find(entry.Day, dayEntries))
+		{
+			dayEntries = new array<int>;
+			m_ByDay.Set(entry.Day, dayEntries);
+			m_Days.InsertAt(entry.Day, LowerBoundInt(m_Days, entry.Day));
+		}
+		dayEntries.InsertAt(entryIndex, UpperBoundEntry(dayEntries, steamID));
+		
+		if (newPlayer)
+			m_SteamIDs.InsertAt(steamID, LowerBound(m_SteamIDs, steamID));
+	}
+	
+	// Run a query against the index (records are used for names and per-player violation lists)
+	SwarmObserverHistoryQueryPage Query(SwarmObserverHistoryQuery query, map<string, ref SwarmObserverPlayerRecord> records)
+	{
+		SwarmObserverHistoryQueryPage page = new SwarmObserverHistoryQueryPage();
+		int pageSize = Math.Clamp(query.PageSize, 1, SwarmObserverConstants.HISTORY_QUERY_MAX_PAGE_SIZE);
+		string fromKey = ToSortKey(query.From, false);
+		string toKey = ToSortKey(query.To, true);
+		
+		if (query.SteamIDPrefix == "" && (query.AreaName != "" || fromKey != "" || toKey != ""))
+			QueryByEntries(query, fromKey, toKey, pageSize, records, page);
+		else
+			QueryByPlayer(query, fromKey, toKey, pageSize, records, page);
+		
+		return page;
+	}
+	
+	// Walk the sorted Steam IDs from the prefix (or cursor) and stop once the page is full or the scan budget is spent
+	private void QueryByPlayer(SwarmObserverHistoryQuery query, string fromKey, string toKey, int pageSize, map<string, ref SwarmObserverPlayerRecord> records, SwarmObserverHistoryQueryPage page)
+	{
+		int start = LowerBound(m_SteamIDs, query.SteamIDPrefix);
+		if (query.Cursor != "")
+			start = Math.Max(start, UpperBound(m_SteamIDs, query.Cursor));
+		
+		for (int i = start; i < m_SteamIDs.Count(); i++)
+		{
+			string steamID = m_SteamIDs[i];
+			if (query.SteamIDPrefix != "" && steamID.IndexOf(query.SteamIDPrefix) != 0)
+				return; // Past the prefix range
+			
+			// Out of budget: let the caller continue from the last player examined
+			if (page.Scanned >= SwarmObserverConstants.HISTORY_QUERY_SCAN_LIMIT || page.Rows.Count() >= pageSize)
+			{
+				page.NextCursor = m_SteamIDs[i - 1];
+				return;
+			}
+			
+			SwarmObserverPlayerRecord record;
+			if (!records.Find(steamID, record))
+				continue;
+			
+			SwarmObserverHistoryQueryRow row = new SwarmObserverHistoryQueryRow();
+			row.SteamID = steamID;
+			row.PlayerName = record.PlayerName;
+			
+			foreach (SwarmObserverViolation violation : record.Violations)
+			{
+				page.Scanned++;
+				if (query.AreaName != "" && violation.AreaName != query.AreaName)
+					continue;
+				
+				string sortKey = ToSortKey(violation.Timestamp, false);
+				if ((fromKey != "" && sortKey < fromKey) || (toKey != "" && sortKey > toKey))
+					continue;
+				
+				AddToRow(row, violation.AreaName, violation.Timestamp, sortKey);
+			}
+			
+			if (row.Count > 0 && row.Count >= query.MinCount)
+				page.Rows.Insert(row);
+		}
+	}
+	
+	// Walk the smaller of the area bucket and the day buckets in range, merging them by Steam ID from the cursor on
+	// Buckets are sorted by Steam ID, so each page starts with a binary search past the cursor, takes one player's
+	// entries at a time and stops once the page is full or the scan budget is spent
+	private void QueryByEntries(SwarmObserverHistoryQuery query, string fromKey, string toKey, int pageSize, map<string, ref SwarmObserverPlayerRecord> records, SwarmObserverHistoryQueryPage page)
+	{
+		array<int> areaEntries;
+		if (query.AreaName != "" && !m_ByArea.Find(query.AreaName, areaEntries))
+			return; // Unknown area
+		
+		array<array<int>> buckets = new array<array<int>>;
+		if (fromKey != "" || toKey != "")
+		{
+			int fromDay = GetDay(fromKey);
+			int toDay = int.MAX;
+			if (toKey != "")
+				toDay = GetDay(toKey);
+			
+			int dayEntryCount = 0;
+			for (int d = LowerBoundInt(m_Days, fromDay); d < m_Days.Count() && m_Days[d] <= toDay; d++)
+			{
+				array<int> dayEntries = m_ByDay.Get(m_Days[d]);
+				buckets.Insert(dayEntries);
+				dayEntryCount += dayEntries.Count();
+			}
+			
+			if (areaEntries && areaEntries.Count() < dayEntryCount)
+			{
+				buckets.Clear();
+				buckets.Insert(areaEntries);
+			}
+		}
+		else
+		{
+			buckets.Insert(areaEntries);
+		}
+		
+		// Seek every bucket past the cursor
+		array<int> positions = new array<int>;
+		foreach (array<int> seekBucket : buckets)
+		{
+			int position = 0;
+			if (query.Cursor != "")
+				position = UpperBoundEntry(seekBucket, query.Cursor);
+			positions.Insert(position);
+		}
+		
+		string lastSteamID = "";
+		while (true)
+		{
+			// Out of budget: let the caller continue from the last player examined
+			if (page.Rows.Count() >= pageSize || page.Scanned >= SwarmObserverConstants.HISTORY_QUERY_SCAN_LIMIT)
+			{
+				if (NextSteamID(buckets, positions) != "")
+					page.NextCursor = lastSteamID;
+				return;
+			}
+			
+			string steamID = NextSteamID(buckets, positions);
+			if (steamID == "")
+				return;
+			
+			SwarmObserverHistoryQueryRow row = new SwarmObserverHistoryQueryRow();
+			row.SteamID = steamID;
+			for (int b = 0; b < buckets.Count(); b++)
+			{
+				array<int> bucket = buckets[b];
+				int p = positions[b];
+				while (p < bucket.Count() && m_Entries[bucket[p]].SteamID == steamID)
+				{
+					SwarmObserverHistoryIndexEntry entry = m_Entries[bucket[p]];
+					p++;
+					page.Scanned++;
+					
+					if (query.AreaName != "" && entry.AreaName != query.AreaName)
+						continue;
+					
+					if ((fromKey != "" && entry.SortKey < fromKey) || (toKey != "" && entry.SortKey > toKey))
+						continue;
+					
+					AddToRow(row, entry.AreaName, entry.Timestamp, entry.SortKey);
+				}
+				positions[b] = p;
+			}
+			lastSteamID = steamID;
+			
+			if (row.Count == 0 || row.Count < query.MinCount)
+				continue;
+			
+			SwarmObserverPlayerRecord record;
+			if (records.Find(steamID, record))
+				row.PlayerName = record.PlayerName;
+			
+			page.Rows.Insert(row);
+		}
+	}
+	
+	// Lowest Steam ID at the buckets' current positions ("" when every bucket is exhausted)
+	private string NextSteamID(array<array<int>> buckets, array<int> positions)
+	{
+		string next = "";
+		for (int b = 0; b < buckets.Count(); b++)
+		{
+			if (positions[b] >= buckets[b].Count())
+				continue;
+			
+			string steamID = m_Entries[buckets[b][positions[b]]].SteamID;
+			if (next == "" || steamID < next)
+				next = steamID;
+		}
+		return next;
+	}
+	
+	private void AddToRow(SwarmObserverHistoryQueryRow row, string areaName, string timestamp, string sortKey)
+	{
+		row.Count++;
+		if (sortKey >= row.LastSortKey)
+		{
+			row.LastSortKey = sortKey;
+			row.LastAreaName = areaName;
+			row.LastTimestamp = timestamp;
+		}
+	}
+	
+	// "dd/mm/yyyy hh:mm:ss" (time optional) -> "yyyymmddhhmmss", "" if the date is malformed
+	static string ToSortKey(string timestamp, bool endOfDay)
+	{
+		timestamp.TrimInPlace();
+		if (timestamp.Length() < 10 || timestamp.Substring(2, 1) != "/" || timestamp.Substring(5, 1) != "/")
+			return "";
+		
+		string date = timestamp.Substring(6, 4) + timestamp.Substring(3, 2) + timestamp.Substring(0, 2);
+		if (timestamp.Length() >= 19)
+			return date + timestamp.Substring(11, 2) + timestamp.Substring(14, 2) + timestamp.Substring(17, 2);
+		
+		if (endOfDay)
+			return date + "235959";
+		
+		return date + "000000";
+	}
+	
+	// Day bucket of a sort key (0 when the timestamp could not be parsed)
+	static int GetDay(string sortKey)
+	{
+		if (sortKey == "")
+			return 0;
+		
+		return sortKey.Substring(0, 8).ToInt();
+	}
+	
+	// First position whose value is >= value
+	private static int LowerBound(array<string> values, string value)
+	{
+		int low = 0;
+		int high = values.Count();
+		while (low < high)
+		{
+			int mid = (low + high) / 2;
+			if (values[mid] < value)
+				low = mid + 1;
+			else
+				high = mid;
+		}
+		return low;
+	}
+	
+	// First position whose value is > value
+	private static int UpperBound(array<string> values, string value)
+	{
+		int low = 0;
+		int high = values.Count();
+		while (low < high)
+		{
+			int mid = (low + high) / 2;
+			if (values[mid] <= value)
+				low = mid + 1;
+			else
+				high = mid;
+		}
+		return low;
+	}
+	
+	// First position in a bucket whose entry's Steam ID is > steamID
+	private int UpperBoundEntry(array<int> bucket, string steamID)
+	{
+		int low = 0;
+		int high = bucket.Count();
+		while (low < high)
+		{
+			int mid = (low + high) / 2;
+			if (m_Entries[bucket[mid]].SteamID <= steamID)
+				low = mid + 1;
+			else
+				high = mid;
+		}
+		return low;
+	}
+	
+	private static int LowerBoundInt(array<int> values, int value)
+	{
+		int low = 0;
+		int high = values.Count();
+		while (low < high)
+		{
+			int mid = (low + high) / 2;
+			if (values[mid] < value)
+				low = mid + 1;
+			else
+				high = mid;
+		}
+		return low;
+	}
+}
+#endif
@@ -0,0 +1,165 @@
+// String interning table
+// Maps strings to small integer handles so combat records only carry ints.
+// Strings are resolved back only when rendering webhooks or debug output.
+class SwarmObserverInternTable
+{
+	private ref map<string, int> m_Handles;
+	private ref array<string> m_Strings;
+	
+	void SwarmObserverInternTable()
+	{
+		m_Handles = new map<string, int>;
+		m_Strings = new array<string>;
+		
+		// Handle 0 is reserved for the empty string
+		m_Strings.Insert("");
+		m_Handles.Set("", 0);
+	}
+	
+	// Get the handle for a string, registering it on first use
+	int Intern(string value)
+	{
+		int handle;
+		if (m_Handles.Find(value, handle))
+			return handle;
+		
+		handle = m_Strings.Insert(value);
+		m_Handles.Set(value, handle);
+		return handle;
+	}
+	
+	// Resolve a handle back to its string
+	string Resolve(int handle)
+	{
+		if (handle < 0 || handle >= m_Strings.Count())
+			return "";
+		
+		return m_Strings[handle];
+	}
+	
+	int Count()
+	{
+		return m_Strings.Count();
+	}
+	
+	// Estimated memory use (each string is held by the map and the array)
+	int GetEstimatedBytes()
+	{
+		int bytes = 0;
+		foreach (string value : m_Strings)
+		{
+			bytes += SwarmObserverConstants.MEMORY_OBJECT_BYTES + 2 * SwarmObserverMemoryReport.StringBytes(value);
+		}
+		return bytes;
+	}
+}
+
+// Ammo and damage type table (interned from CfgAmmo class names)
+class SwarmObserverAmmoTable : SwarmObserverInternTable
+{
+	private static ref SwarmObserverAmmoTable s_Instance;
+	
+	// Get singleton instance
+	static SwarmObserverAmmoTable GetInstance()
+	{
+		if (!s_Instance)
+		{
+			s_Instance = new SwarmObserverAmmoTable();
+		}
+		return s_Instance;
+	}
+}
+
+// Player identity table
+// Each Steam ID gets a stable small integer handle for the lifetime of the server.
+// Handle 0 means "no identity" (AI, disconnected or unknown source).
+class SwarmObserverIdentityTable
+{
+	private static ref SwarmObserverIdentityTable s_Instance;
+	private ref map<string, int> m_Handles;
+	private ref array<string> m_SteamIDs;
+	private ref array<string> m_Names;
+	
+	void SwarmObserverIdentityTable()
+	{
+		m_Handles = new map<string, int>;
+		m_SteamIDs = new array<string>;
+		m_Names = new array<string>;
+		
+		// Reserve handle 0
+		m_SteamIDs.Insert("");
+		m_Names.Insert("");
+	}
+	
+	// Get singleton instance
+	static SwarmObserverIdentityTable GetInstance()
+	{
+		if (!s_Instance)
+		{
+			s_Instance = new SwarmObserverIdentityTable();
+		}
+		return s_Instance;
+	}
+	
+	// Register an identity and return its handle (updates the display name if it changed)
+	int Register(string steamID, string playerName)
+	{
+		if (steamID == "")
+			return 0;
+		
+		int handle;
+		if (m_Handles.Find(steamID, handle))
+		{
+			m_Names.Set(handle, playerName);
+			return handle;
+		}
+		
+		handle = m_SteamIDs.Insert(steamID);
+		m_Names.Insert(playerName);
+		m_Handles.Set(steamID, handle);
+		return handle;
+	}
+	
+	// Find an existing handle without registering (0 if unknown)
+	int Find(string steamID)
+	{
+		int handle;
+		if (m_Handles.Find(steamID, handle))
+			return handle;
+		
+		return 0;
+	}
+	
+	string GetSteamID(int handle)
+	{
+		if (handle <= 0 || handle >= m_SteamIDs.Count())
+			return "";
+		
+		return m_SteamIDs[handle];
+	}
+	
+	string GetName(int handle)
+	{
+		if (handle <= 0 || handle >= m_Names.Count())
+			return "";
+		
+		return m_Names[handle];
+	}
+	
+	// Estimated memory use (Steam IDs are held by the map and the array)
+	// Handles stay valid for the server lifetime, so this table is bounded by unique players rather than capped.
+	int GetEstimatedBytes()
+	{
+		int bytes = 0;
+		for (int i = 0; i < m_SteamIDs.Count(); i++)
+		{
+			bytes += SwarmObserverConstants.MEMORY_OBJECT_BYTES + 2 * SwarmObserverMemoryReport.StringBytes(m_SteamIDs[i]) + SwarmObserverMemoryReport.StringBytes(m_Names[i]);
+		}
+		return bytes;
+	}
+	
+	int Count()
+	{
+		return m_SteamIDs.Count();
+	}
+}
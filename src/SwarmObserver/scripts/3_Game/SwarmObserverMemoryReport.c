@@ -0,0 +1,73 @@
+// Memory report of the in-memory stores
+// Sizes are estimates (string characters plus MEMORY_OBJECT_BYTES / MEMORY_STRING_BYTES per object and string),
+// good enough to spot a store that keeps growing. 4_World stores are added by a modded Collect().
+class SwarmObserverMemoryReport
+{
+	protected ref array<string> m_Lines;
+	protected int m_TotalBytes;
+	
+	void SwarmObserverMemoryReport()
+	{
+		m_Lines = new array<string>;
+		m_TotalBytes = 0;
+	}
+	
+	// Estimated size of a string
+	static int StringBytes(string value)
+	{
+		return SwarmObserverConstants.MEMORY_STRING_BYTES + value.Length();
+	}
+	
+	// Add one store (cap 0 means unbounded)
+	void AddStore(string name, int entries, int cap, int bytes)
+	{
+		string capText = "no cap";
+		if (cap > 0)
+			capText = "cap " + cap;
+		
+		m_Lines.Insert(string.Format("%1: %2 entries (%3), ~%4 KB", name, entries, capText, bytes / 1024));
+		m_TotalBytes += bytes;
+	}
+	
+	// Gather every store
+	void Collect()
+	{
+		SwarmObserverSettingsSnapshot settings = SwarmObserverSettingsSnapshot.Get();
+		
+		#ifndef SWARM_OBSERVER_NO_ZONES
+		AddStore("History records", SwarmObserverHistory.GetRecordCount(), settings.MaxHistoryRecords, SwarmObserverHistory.GetEstimatedBytes());
+		AddStore("Grace periods", SwarmObserverGracePeriodManager.GetActiveGracePeriods().Count(), settings.MaxGracePeriods, SwarmObserverGracePeriodManager.GetEstimatedBytes());
+		#endif
+		
+		SwarmObserverIdentityTable identities = SwarmObserverIdentityTable.GetInstance();
+		AddStore("Identity table", identities.Count(), 0, identities.GetEstimatedBytes());
+		
+		SwarmObserverAmmoTable ammo = SwarmObserverAmmoTable.GetInstance();
+		AddStore("Ammo table", ammo.Count(), 0, ammo.GetEstimatedBytes());
+	}
+	
+	// Store lines collected so far
+	array<string> GetLines()
+	{
+		return m_Lines;
+	}
+	
+	int GetTotalBytes()
+	{
+		return m_TotalBytes;
+	}
+	
+	// Collect and log the report
+	static void Dump()
+	{
+		SwarmObserverMemoryReport report = new SwarmObserverMemoryReport();
+		report.Collect();
+		
+		Print("[SwarmObserver] Memory report:");
+		foreach (string line : report.m_Lines)
+		{
+			Print("[SwarmObserver]   - " + line);
+		}
+		Print("[SwarmObserver]   Total: ~" + (report.m_TotalBytes / 1024) + " KB");
+	}
+}
@@ -0,0 +1,95 @@
+// Hot paths measured by SwarmObserverMetrics
+enum SwarmObserverMetric
+{
+	HIT,           // PlayerBase.EEHitBy (player vs player damage)
+	SHOT,          // Shot proximity check
+	EXPLOSION,     // Explosive proximity check
+	COMBAT_ACTION, // CombatStateManager action registration
+	DISCONNECT,    // Disconnect bookkeeping (area lookup, combat check)
+	COUNT
+}
+
+// Call counts and timings of the hot paths (read by admin tools, only reset by the benchmark once its warmup is over)
+// Samples are TickCount deltas, reported in milliseconds.
+class SwarmObserverMetrics
+{
+	private static ref SwarmObserverMetrics s_Instance;
+	private ref array<int> m_Calls;
+	private ref array<float> m_TotalTicks;
+	private ref array<int> m_MaxTicks;
+	
+	void SwarmObserverMetrics()
+	{
+		m_Calls = new array<int>;
+		m_TotalTicks = new array<float>;
+		m_MaxTicks = new array<int>;
+		
+		for (int i = 0; i < SwarmObserverMetric.COUNT; i++)
+		{
+			m_Calls.Insert(0);
+			m_TotalTicks.Insert(0);
+			m_MaxTicks.Insert(0);
+		}
+	}
+	
+	// Get singleton instance
+	static SwarmObserverMetrics GetInstance()
+	{
+		if (!s_Instance)
+		{
+			s_Instance = new SwarmObserverMetrics();
+		}
+		return s_Instance;
+	}
+	
+	// Record one call of a hot path (ticks = TickCount(startTicks))
+	static void Record(int metric, int ticks)
+	{
+		SwarmObserverMetrics metrics = GetInstance();
+		metrics.m_Calls[metric] = metrics.m_Calls[metric] + 1;
+		metrics.m_TotalTicks[metric] = metrics.m_TotalTicks[metric] + ticks;
+		if (ticks > metrics.m_MaxTicks[metric])
+			metrics.m_MaxTicks[metric] = ticks;
+	}
+	
+	// Forget all samples
+	static void Reset()
+	{
+		SwarmObserverMetrics metrics = GetInstance();
+		for (int i = 0; i < SwarmObserverMetric.COUNT; i++)
+		{
+			metrics.m_Calls[i] = 0;
+			metrics.m_TotalTicks[i] = 0;
+			metrics.m_MaxTicks[i] = 0;
+		}
+	}
+	
+	static int GetCalls(int metric)
+	{
+		return GetInstance().m_Calls[metric];
+	}
+	
+	static float GetAverageMs(int metric)
+	{
+		SwarmObserverMetrics metrics = GetInstance();
+		if (metrics.m_Calls[metric] == 0)
+			return 0;
+		
+		return metrics.m_TotalTicks[metric] / metrics.m_Calls[metric] / 10000.0;
+	}
+	
+	static float GetTotalMs(int metric)
+	{
+		return GetInstance().m_TotalTicks[metric] / 10000.0;
+	}
+	
+	static float GetMaxMs(int metric)
+	{
+		return GetInstance().m_MaxTicks[metric] / 10000.0;
+	}
+	
+	static string GetName(int metric)
+	{
+		return typename.EnumToString(SwarmObserverMetric, metric);
+	}
+}
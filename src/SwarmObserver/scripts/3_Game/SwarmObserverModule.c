@@ -29,6 +29,23 @@ class SwarmObserverModule
 		Print("[SwarmObserver] Directory created: " + SwarmObserverConstants.DIR_SWARM_OBSERVER);
 	}
 	
+	// Reload config or log a memory report when the matching trigger file exists (polled by timer)
+	void CheckReloadTrigger()
+	{
+		if (FileExist(SwarmObserverConstants.FILE_RELOAD_TRIGGER))
+		{
+			DeleteFile(SwarmObserverConstants.FILE_RELOAD_TRIGGER);
+			Print("[SwarmObserver] Reload trigger found, reloading config...");
+			SwarmObserverSettings.ReloadConfig();
+		}
+		
+		if (FileExist(SwarmObserverConstants.FILE_MEMORY_REPORT_TRIGGER))
+		{
+			DeleteFile(SwarmObserverConstants.FILE_MEMORY_REPORT_TRIGGER);
+			SwarmObserverMemoryReport.Dump();
+		}
+	}
+	
 	// Initialize the module (called from MissionServer.OnInit)
 	static void Initialize()
 	{
@@ -37,14 +54,31 @@ class SwarmObserverModule
 		// Ensure instance exists (creates directories)
 		GetInstance();
 		
+		// Benchmark mode must be known before anything is loaded: it disables saving, webhooks and cluster logs
+		SwarmObserverBenchmarkSettings.Detect();
+		
 		// Load configuration (creates config.json if missing)
 		SwarmObserverSettings.LoadConfig();
 		
+		#ifndef SWARM_OBSERVER_NO_ZONES
 		// Load history (creates history database structure)
 		SwarmObserverHistory.LoadHistory();
 		
+		// Share history with other servers when cluster mode is configured
+		SwarmObserverCluster.Initialize();
+		
+		// History store benchmark (only with the -swarmObserverHistoryBenchmark launch parameter)
+		SwarmObserverHistoryBenchmark.Start();
+		#endif
+		
+		// Restore grace periods and combat data left by a restart
+		SwarmObserverWarmState.Restore();
+		
 		// Note: Combat system initializes lazily when first accessed
 		
+		// Watch for the trigger files so settings can be tuned and memory inspected without a restart
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(GetInstance().CheckReloadTrigger, SwarmObserverConstants.CONFIG_RELOAD_POLL_MS, true);
+		
 		Print("[SwarmObserver] Initialization complete");
 	}
 }
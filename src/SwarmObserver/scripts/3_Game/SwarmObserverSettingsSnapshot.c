@@ -0,0 +1,317 @@
+// Parsed webhook endpoint (host and path split once when the snapshot is built)
+class SwarmObserverEndpoint
+{
+	string Host;
+	string Path;
+	bool Valid;
+	
+	void SwarmObserverEndpoint(string url)
+	{
+		Host = "";
+		Path = "/";
+		Valid = false;
+		
+		if (url == "" || url.Contains("YOUR_WEBHOOK"))
+			return;
+		
+		// Remove https:// or http://
+		if (url.IndexOf("https://") == 0)
+		{
+			url = url.Substring(8, url.Length() - 8);
+		}
+		else if (url.IndexOf("http://") == 0)
+		{
+			url = url.Substring(7, url.Length() - 7);
+		}
+		
+		// Split host and path
+		int slashPos = url.IndexOf("/");
+		if (slashPos > 0)
+		{
+			Host = url.Substring(0, slashPos);
+			Path = url.Substring(slashPos, url.Length() - slashPos);
+		}
+		else
+		{
+			Host = url;
+		}
+		
+		Valid = Host != "";
+	}
+}
+
+// Restricted area compiled for the zone index
+class SwarmObserverZone
+{
+	ref SwarmObserverRestrictedArea Area;
+	float RadiusSq;
+	
+	void SwarmObserverZone(SwarmObserverRestrictedArea area)
+	{
+		// Keep a private copy so later config reloads can never mutate a published snapshot
+		Area = new SwarmObserverRestrictedArea(area.Name, area.Position, area.Radius);
+		RadiusSq = area.Radius * area.Radius;
+	}
+	
+	bool Contains(vector pos)
+	{
+		return vector.DistanceSq(pos, Area.Position) <= RadiusSq;
+	}
+}
+
+// Immutable hot-path settings snapshot
+// Built from SwarmObserverSettings after validation and swapped in as a whole on (re)load.
+// Hot paths only read plain fields: durations are precomputed in milliseconds and radii squared.
+class SwarmObserverSettingsSnapshot
+{
+	private static ref SwarmObserverSettingsSnapshot s_Current;
+	
+	bool CombatLogoutEnabled;
+	bool CombatDebugMode;
+	int CombatDurationMs;
+	int CombatLogoutGraceMs;
+	int CombatLogoutDedupeMs;
+	int GracePeriodMs;
+	float ShotProximityRadius;
+	float ShotProximityRadiusSq;
+	float ShotAudibleFireScale;
+	float ShotTrajectoryRange;
+	float ShotTrajectoryRadius;
+	float ExplosiveProximityRadius;
+	float ExplosiveProximityRadiusSq;
+	float ExplosiveHitRangeScale;
+	int MaxHistoryRecords;
+	int MaxGracePeriods;
+	int MaxCombatStates;
+	int MaxLogoutData;
+	
+	ref SwarmObserverEndpoint Webhook;
+	ref SwarmObserverEndpoint CombatWebhook;
+	
+	// Zone index: uniform grid of cells, each listing the zones overlapping it
+	ref array<ref SwarmObserverZone> Zones;
+	ref map<int, ref array<SwarmObserverZone>> ZoneCells;
+	
+	// Shot radius overrides by ammo type, and radii resolved from game config on first use.
+	// The caches only depend on this snapshot and static config, so a reload starts them fresh.
+	private ref map<string, ref SwarmObserverShotRadiusOverride> m_ShotRadiusOverrides;
+	private ref map<string, float> m_ShotRadiusCache;
+	private ref map<string, float> m_ShotRangeCache;
+	private ref map<string, float> m_SuppressorFactorCache;
+	private ref map<string, float> m_ExplosiveRadiusCache;
+	
+	void SwarmObserverSettingsSnapshot(SwarmObserverSettings settings)
+	{
+		CombatLogoutEnabled = settings.CombatLogoutEnabled;
+		CombatDebugMode = settings.CombatDebugMode;
+		CombatDurationMs = settings.CombatDurationSeconds * 1000;
+		CombatLogoutGraceMs = settings.CombatLogoutGraceSeconds * 1000;
+		CombatLogoutDedupeMs = settings.CombatLogoutDedupeSeconds * 1000;
+		GracePeriodMs = settings.GracePeriodSeconds * 1000;
+		ShotProximityRadius = settings.ShotProximityRadius;
+		ShotProximityRadiusSq = settings.ShotProximityRadius * settings.ShotProximityRadius;
+		ShotAudibleFireScale = settings.ShotAudibleFireScale;
+		ShotTrajectoryRange = settings.ShotTrajectoryRange;
+		ShotTrajectoryRadius = settings.ShotTrajectoryRadius;
+		ExplosiveProximityRadius = settings.ExplosiveProximityRadius;
+		ExplosiveProximityRadiusSq = settings.ExplosiveProximityRadius * settings.ExplosiveProximityRadius;
+		ExplosiveHitRangeScale = settings.ExplosiveHitRangeScale;
+		MaxHistoryRecords = settings.MaxHistoryRecords;
+		MaxGracePeriods = settings.MaxGracePeriods;
+		MaxCombatStates = settings.MaxCombatStates;
+		MaxLogoutData = settings.MaxLogoutData;
+		
+		// Combat webhook falls back to the main webhook when not set (benchmark runs never post)
+		string webhookURL = settings.WebhookURL;
+		string combatWebhookURL = settings.CombatWebhookURL;
+		if (SwarmObserverBenchmarkSettings.IsActive())
+		{
+			webhookURL = "";
+			combatWebhookURL = "";
+		}
+		
+		Webhook = new SwarmObserverEndpoint(webhookURL);
+		if (combatWebhookURL != "")
+			CombatWebhook = new SwarmObserverEndpoint(combatWebhookURL);
+		else
+			CombatWebhook = Webhook;
+		
+		BuildZoneIndex(settings.RestrictedAreas);
+		
+		m_ShotRadiusOverrides = new map<string, ref SwarmObserverShotRadiusOverride>;
+		m_ShotRadiusCache = new map<string, float>;
+		m_ShotRangeCache = new map<string, float>;
+		m_SuppressorFactorCache = new map<string, float>;
+		m_ExplosiveRadiusCache = new map<string, float>;
+		if (settings.ShotRadiusOverrides)
+		{
+			foreach (SwarmObserverShotRadiusOverride shotOverride : settings.ShotRadiusOverrides)
+			{
+				m_ShotRadiusOverrides.Set(shotOverride.AmmoType, new SwarmObserverShotRadiusOverride(shotOverride.AmmoType, shotOverride.Radius, shotOverride.SuppressedRadius));
+			}
+		}
+	}
+	
+	// Get the current snapshot (built from the current settings if nothing was published yet)
+	static SwarmObserverSettingsSnapshot Get()
+	{
+		if (!s_Current)
+		{
+			s_Current = new SwarmObserverSettingsSnapshot(SwarmObserverSettings.GetInstance());
+		}
+		return s_Current;
+	}
+	
+	// Swap in a new snapshot
+	static void Publish(SwarmObserverSettingsSnapshot snapshot)
+	{
+		s_Current = snapshot;
+	}
+	
+	private void BuildZoneIndex(array<ref SwarmObserverRestrictedArea> areas)
+	{
+		Zones = new array<ref SwarmObserverZone>;
+		ZoneCells = new map<int, ref array<SwarmObserverZone>>;
+		
+		foreach (SwarmObserverRestrictedArea area : areas)
+		{
+			SwarmObserverZone zone = new SwarmObserverZone(area);
+			Zones.Insert(zone);
+			
+			// Register the zone in every cell its bounding square overlaps
+			int minX = GetCellCoord(area.Position[0] - area.Radius);
+			int maxX = GetCellCoord(area.Position[0] + area.Radius);
+			int minZ = GetCellCoord(area.Position[2] - area.Radius);
+			int maxZ = GetCellCoord(area.Position[2] + area.Radius);
+			
+			for (int x = minX; x <= maxX; x++)
+			{
+				for (int z = minZ; z <= maxZ; z++)
+				{
+					int key = GetCellKey(x, z);
+					array<SwarmObserverZone> cell;
+					if (!ZoneCells.Find(key, cell))
+					{
+						cell = new array<SwarmObserverZone>;
+						ZoneCells.Set(key, cell);
+					}
+					cell.Insert(zone);
+				}
+			}
+		}
+	}
+	
+	// Find the zone containing a position (single cell lookup, no square roots)
+	SwarmObserverZone FindZone(vector pos)
+	{
+		array<SwarmObserverZone> cell;
+		if (!ZoneCells.Find(GetCellKey(GetCellCoord(pos[0]), GetCellCoord(pos[2])), cell))
+			return null;
+		
+		foreach (SwarmObserverZone zone : cell)
+		{
+			if (zone.Contains(pos))
+				return zone;
+		}
+		
+		return null;
+	}
+	
+	// Get the audible radius of a shot (suppressorType is empty when the weapon is not suppressed)
+	// Never larger than ShotProximityRadius. Config lookups only happen the first time a type is seen.
+	float GetShotRadius(string ammoType, string suppressorType)
+	{
+		float radius;
+		if (!m_ShotRadiusCache.Find(ammoType, radius))
+		{
+			radius = ResolveShotRadius(ammoType);
+			m_ShotRadiusCache.Set(ammoType, radius);
+		}
+		
+		if (suppressorType == "")
+			return radius;
+		
+		SwarmObserverShotRadiusOverride shotOverride;
+		if (m_ShotRadiusOverrides.Find(ammoType, shotOverride) && shotOverride.SuppressedRadius > 0)
+			return Math.Min(shotOverride.SuppressedRadius, ShotProximityRadius);
+		
+		float factor;
+		if (!m_SuppressorFactorCache.Find(suppressorType, factor))
+		{
+			// noiseShootModifier is negative for suppressors (-0.9 removes 90% of the noise)
+			factor = Math.Clamp(1.0 + GetGame().ConfigGetFloat("CfgVehicles " + suppressorType + " noiseShootModifier"), 0, 1);
+			m_SuppressorFactorCache.Set(suppressorType, factor);
+		}
+		
+		return radius * factor;
+	}
+	
+	// Unsuppressed radius from the override table, else CfgAmmo audibleFire (ShotProximityRadius if not set)
+	private float ResolveShotRadius(string ammoType)
+	{
+		SwarmObserverShotRadiusOverride shotOverride;
+		if (m_ShotRadiusOverrides.Find(ammoType, shotOverride) && shotOverride.Radius > 0)
+			return Math.Min(shotOverride.Radius, ShotProximityRadius);
+		
+		float audibleFire = GetGame().ConfigGetFloat("CfgAmmo " + ammoType + " audibleFire");
+		if (audibleFire <= 0 || ShotAudibleFireScale <= 0)
+			return ShotProximityRadius;
+		
+		return Math.Min(audibleFire * ShotAudibleFireScale, ShotProximityRadius);
+	}
+	
+	// Get the length of the shot trajectory capsule for an ammo type
+	// Bullets slow down as dv/dt = airFriction * v^2, so they reach SHOT_TRAJECTORY_SPEED_FRACTION of any starting speed
+	// after ln(1 / fraction) / -airFriction meters. Never longer than ShotTrajectoryRange. Cached per ammo type.
+	float GetShotTrajectoryRange(string ammoType)
+	{
+		float range;
+		if (m_ShotRangeCache.Find(ammoType, range))
+			return range;
+		
+		float airFriction = GetGame().ConfigGetFloat("CfgAmmo " + ammoType + " airFriction");
+		if (airFriction >= 0)
+			range = ShotTrajectoryRange;
+		else
+			range = Math.Min(Math.Log2(1.0 / SwarmObserverConstants.SHOT_TRAJECTORY_SPEED_FRACTION) * 0.693147 / -airFriction, ShotTrajectoryRange); // ln(x) = log2(x) * ln(2)
+		
+		m_ShotRangeCache.Set(ammoType, range);
+		return range;
+	}
+	
+	// Get the proximity radius of an explosive item (largest CfgAmmo indirectHitRange of its ammo types, scaled)
+	// Never larger than ExplosiveProximityRadius. Cached per item type.
+	float GetExplosiveRadius(string itemType, array<string> ammoTypes)
+	{
+		float radius;
+		if (m_ExplosiveRadiusCache.Find(itemType, radius))
+			return radius;
+		
+		float hitRange = 0;
+		if (ammoTypes)
+		{
+			foreach (string ammoType : ammoTypes)
+			{
+				hitRange = Math.Max(hitRange, GetGame().ConfigGetFloat("CfgAmmo " + ammoType + " indirectHitRange"));
+			}
+		}
+		
+		if (hitRange <= 0 || ExplosiveHitRangeScale <= 0)
+			radius = ExplosiveProximityRadius;
+		else
+			radius = Math.Min(hitRange * ExplosiveHitRangeScale, ExplosiveProximityRadius);
+		
+		m_ExplosiveRadiusCache.Set(itemType, radius);
+		return radius;
+	}
+	
+	private static int GetCellCoord(float value)
+	{
+		return Math.Floor(value / SwarmObserverConstants.ZONE_INDEX_CELL_SIZE);
+	}
+	
+	private static int GetCellKey(int x, int z)
+	{
+		return (x << 16) ^ (z & 0xFFFF);
+	}
+}
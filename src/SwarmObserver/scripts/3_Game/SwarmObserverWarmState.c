@@ -0,0 +1,418 @@
+// Warm restart snapshot
+// Live grace periods, combat states and pending combat logouts are written to a compact binary file on shutdown
+// and read back on the next start. Timestamps are stored as ages (ms before the snapshot) and the wall-clock
+// downtime is added on restore, so every deadline keeps running across the restart.
+
+// Grace period carried across a restart
+class SwarmObserverWarmGrace
+{
+	string SteamID;
+	string PlayerName;
+	string AreaName;
+	int DisconnectAgeMs;
+	
+	void Write(Serializer ctx)
+	{
+		ctx.Write(SteamID);
+		ctx.Write(PlayerName);
+		ctx.Write(AreaName);
+		ctx.Write(DisconnectAgeMs);
+	}
+	
+	bool Read(Serializer ctx)
+	{
+		return ctx.Read(SteamID) && ctx.Read(PlayerName) && ctx.Read(AreaName) && ctx.Read(DisconnectAgeMs);
+	}
+}
+
+// Combat state carried across a restart (handles resolved to Steam IDs and class names, they are not stable across restarts)
+class SwarmObserverWarmCombat
+{
+	string SteamID;
+	int StartAgeMs;
+	int LastActionAgeMs;
+	vector LastPosition;
+	string LastDamageType;
+	float LastHealthLevel;
+	
+	ref array<string> InvolvedSteamIDs;
+	ref array<string> InvolvedNames;
+	
+	// Actions, oldest first
+	ref array<int> ActionTypes;
+	ref array<int> ActionAgesMs;
+	ref array<string> ActionOtherSteamIDs;
+	ref array<string> ActionOtherNames;
+	ref array<string> ActionDamageTypes;
+	ref array<float> ActionDistances;
+	ref array<vector> ActionPositions;
+	
+	// Trail samples, oldest first (packed as in CombatState)
+	ref array<int> TrailXZ;
+	ref array<int> TrailYT;
+	
+	void SwarmObserverWarmCombat()
+	{
+		InvolvedSteamIDs = new array<string>;
+		InvolvedNames = new array<string>;
+		ActionTypes = new array<int>;
+		ActionAgesMs = new array<int>;
+		ActionOtherSteamIDs = new array<string>;
+		ActionOtherNames = new array<string>;
+		ActionDamageTypes = new array<string>;
+		ActionDistances = new array<float>;
+		ActionPositions = new array<vector>;
+		TrailXZ = new array<int>;
+		TrailYT = new array<int>;
+	}
+	
+	void AddDowntime(int downtimeMs)
+	{
+		StartAgeMs += downtimeMs;
+		LastActionAgeMs += downtimeMs;
+		for (int i = 0; i < ActionAgesMs.Count(); i++)
+		{
+			ActionAgesMs[i] = ActionAgesMs[i] + downtimeMs;
+		}
+	}
+	
+	void Write(Serializer ctx)
+	{
+		ctx.Write(SteamID);
+		ctx.Write(StartAgeMs);
+		ctx.Write(LastActionAgeMs);
+		ctx.Write(LastPosition);
+		ctx.Write(LastDamageType);
+		ctx.Write(LastHealthLevel);
+		ctx.Write(InvolvedSteamIDs);
+		ctx.Write(InvolvedNames);
+		ctx.Write(ActionTypes);
+		ctx.Write(ActionAgesMs);
+		ctx.Write(ActionOtherSteamIDs);
+		ctx.Write(ActionOtherNames);
+		ctx.Write(ActionDamageTypes);
+		ctx.Write(ActionDistances);
+		
+		// Vectors one by one (three floats each)
+		ctx.Write(ActionPositions.Count());
+		foreach (vector position : ActionPositions)
+		{
+			ctx.Write(position);
+		}
+		
+		ctx.Write(TrailXZ);
+		ctx.Write(TrailYT);
+	}
+	
+	bool Read(Serializer ctx)
+	{
+		if (!ctx.Read(SteamID) || !ctx.Read(StartAgeMs) || !ctx.Read(LastActionAgeMs) || !ctx.Read(LastPosition))
+			return false;
+		
+		if (!ctx.Read(LastDamageType) || !ctx.Read(LastHealthLevel) || !ctx.Read(InvolvedSteamIDs) || !ctx.Read(InvolvedNames))
+			return false;
+		
+		if (!ctx.Read(ActionTypes) || !ctx.Read(ActionAgesMs) || !ctx.Read(ActionOtherSteamIDs) || !ctx.Read(ActionOtherNames))
+			return false;
+		
+		if (!ctx.Read(ActionDamageTypes) || !ctx.Read(ActionDistances))
+			return false;
+		
+		int positionCount;
+		if (!ctx.Read(positionCount))
+			return false;
+		
+		for (int i = 0; i < positionCount; i++)
+		{
+			vector position;
+			if (!ctx.Read(position))
+				return false;
+			
+			ActionPositions.Insert(position);
+		}
+		
+		return ctx.Read(TrailXZ) && ctx.Read(TrailYT);
+	}
+}
+
+// Combat logout (pending alert or dedupe window) carried across a restart
+class SwarmObserverWarmCombatLogout
+{
+	string SteamID;
+	string PlayerName;
+	vector Position;
+	int DisconnectAgeMs;
+	int WindowAgeMs;
+	int LogoutCount;
+	bool Pending;
+	bool AlertSent;
+	ref SwarmObserverWarmCombat State; // Only kept while the alert is pending
+	
+	void AddDowntime(int downtimeMs)
+	{
+		DisconnectAgeMs += downtimeMs;
+		WindowAgeMs += downtimeMs;
+		if (State)
+			State.AddDowntime(downtimeMs);
+	}
+	
+	void Write(Serializer ctx)
+	{
+		ctx.Write(SteamID);
+		ctx.Write(PlayerName);
+		ctx.Write(Position);
+		ctx.Write(DisconnectAgeMs);
+		ctx.Write(WindowAgeMs);
+		ctx.Write(LogoutCount);
+		ctx.Write(Pending);
+		ctx.Write(AlertSent);
+		
+		bool hasState = State != null;
+		ctx.Write(hasState);
+		if (hasState)
+			State.Write(ctx);
+	}
+	
+	bool Read(Serializer ctx)
+	{
+		if (!ctx.Read(SteamID) || !ctx.Read(PlayerName) || !ctx.Read(Position) || !ctx.Read(DisconnectAgeMs))
+			return false;
+		
+		if (!ctx.Read(WindowAgeMs) || !ctx.Read(LogoutCount) || !ctx.Read(Pending) || !ctx.Read(AlertSent))
+			return false;
+		
+		bool hasState;
+		if (!ctx.Read(hasState))
+			return false;
+		
+		if (hasState)
+		{
+			State = new SwarmObserverWarmCombat();
+			return State.Read(ctx);
+		}
+		
+		return true;
+	}
+}
+
+// Warm state container and file handling
+class SwarmObserverWarmState
+{
+	private static ref SwarmObserverWarmState s_Restored;
+	
+	ref array<ref SwarmObserverWarmGrace> GracePeriods;
+	ref array<ref SwarmObserverWarmCombat> CombatStates;
+	ref array<ref SwarmObserverWarmCombatLogout> CombatLogouts;
+	
+	// Restored combat states waiting for their player to reconnect
+	private ref map<string, ref SwarmObserverWarmCombat> m_CombatBySteamID;
+	
+	void SwarmObserverWarmState()
+	{
+		GracePeriods = new array<ref SwarmObserverWarmGrace>;
+		CombatStates = new array<ref SwarmObserverWarmCombat>;
+		CombatLogouts = new array<ref SwarmObserverWarmCombatLogout>;
+		m_CombatBySteamID = new map<string, ref SwarmObserverWarmCombat>;
+	}
+	
+	// Get the snapshot restored on startup (null if there was none)
+	static SwarmObserverWarmState GetRestored()
+	{
+		return s_Restored;
+	}
+	
+	// Write the snapshot (called from the shutdown path)
+	bool Save()
+	{
+		// Synthetic benchmark state must not be restored into a real run
+		if (SwarmObserverBenchmarkSettings.IsActive())
+			return false;
+		
+		FileSerializer file = new FileSerializer();
+		if (!file.Open(SwarmObserverConstants.FILE_WARM_STATE, FileMode.WRITE))
+		{
+			Print("[SwarmObserver] Failed to write warm restart snapshot");
+			return false;
+		}
+		
+		file.Write(SwarmObserverConstants.WARM_STATE_VERSION);
+		file.Write(GetEpochSeconds());
+		
+		file.Write(GracePeriods.Count());
+		foreach (SwarmObserverWarmGrace grace : GracePeriods)
+		{
+			grace.Write(file);
+		}
+		
+		file.Write(CombatStates.Count());
+		foreach (SwarmObserverWarmCombat combat : CombatStates)
+		{
+			combat.Write(file);
+		}
+		
+		file.Write(CombatLogouts.Count());
+		foreach (SwarmObserverWarmCombatLogout combatLogout : CombatLogouts)
+		{
+			combatLogout.Write(file);
+		}
+		
+		file.Close();
+		
+		Print("[SwarmObserver] Warm restart snapshot saved (" + GracePeriods.Count() + " grace periods, " + CombatStates.Count() + " combat states, " + CombatLogouts.Count() + " combat logouts)");
+		return true;
+	}
+	
+	// Read the snapshot left by the previous run, if any (called from SwarmObserverModule.Initialize)
+	// The file is consumed so a later crash can never restore stale state.
+	static void Restore()
+	{
+		// Benchmark runs leave the snapshot for the next real start
+		if (SwarmObserverBenchmarkSettings.IsActive() || !FileExist(SwarmObserverConstants.FILE_WARM_STATE))
+			return;
+		
+		int startTicks = TickCount(0);
+		
+		SwarmObserverWarmState state = new SwarmObserverWarmState();
+		int downtimeMs;
+		bool loaded = state.Load(downtimeMs);
+		DeleteFile(SwarmObserverConstants.FILE_WARM_STATE);
+		
+		if (!loaded)
+			return;
+		
+		foreach (SwarmObserverWarmGrace grace : state.GracePeriods)
+		{
+			grace.DisconnectAgeMs += downtimeMs;
+		}
+		
+		foreach (SwarmObserverWarmCombat combat : state.CombatStates)
+		{
+			combat.AddDowntime(downtimeMs);
+			state.m_CombatBySteamID.Set(combat.SteamID, combat);
+		}
+		
+		foreach (SwarmObserverWarmCombatLogout combatLogout : state.CombatLogouts)
+		{
+			combatLogout.AddDowntime(downtimeMs);
+		}
+		
+		#ifndef SWARM_OBSERVER_NO_ZONES
+		foreach (SwarmObserverWarmGrace restoredGrace : state.GracePeriods)
+		{
+			SwarmObserverGracePeriodManager.RestoreGracePeriod(restoredGrace.SteamID, restoredGrace.PlayerName, restoredGrace.AreaName, GetGame().GetTime() - restoredGrace.DisconnectAgeMs);
+		}
+		#endif
+		
+		s_Restored = state;
+		
+		Print("[SwarmObserver] Warm restart snapshot restored after " + (downtimeMs / 1000) + "s downtime (" + state.GracePeriods.Count() + " grace periods, " + state.CombatStates.Count() + " combat states, " + state.CombatLogouts.Count() + " combat logouts) in " + (TickCount(startTicks) / 10000) + "ms");
+	}
+	
+	private bool Load(out int downtimeMs)
+	{
+		FileSerializer file = new FileSerializer();
+		if (!file.Open(SwarmObserverConstants.FILE_WARM_STATE, FileMode.READ))
+			return false;
+		
+		int version;
+		int savedEpoch;
+		if (!file.Read(version) || version != SwarmObserverConstants.WARM_STATE_VERSION || !file.Read(savedEpoch))
+		{
+			Print("[SwarmObserver] Warm restart snapshot has an unknown format, ignoring it");
+			file.Close();
+			return false;
+		}
+		
+		int downtimeSeconds = GetEpochSeconds() - savedEpoch;
+		if (downtimeSeconds < 0 || downtimeSeconds > SwarmObserverConstants.WARM_STATE_MAX_AGE_SECONDS)
+		{
+			Print("[SwarmObserver] Warm restart snapshot is " + downtimeSeconds + "s old, ignoring it");
+			file.Close();
+			return false;
+		}
+		downtimeMs = downtimeSeconds * 1000;
+		
+		bool ok = ReadSections(file);
+		file.Close();
+		
+		if (!ok)
+			Print("[SwarmObserver] Warm restart snapshot is truncated, ignoring it");
+		
+		return ok;
+	}
+	
+	private bool ReadSections(Serializer ctx)
+	{
+		int count;
+		int i;
+		
+		if (!ctx.Read(count))
+			return false;
+		
+		for (i = 0; i < count; i++)
+		{
+			SwarmObserverWarmGrace grace = new SwarmObserverWarmGrace();
+			if (!grace.Read(ctx))
+				return false;
+			
+			GracePeriods.Insert(grace);
+		}
+		
+		if (!ctx.Read(count))
+			return false;
+		
+		for (i = 0; i < count; i++)
+		{
+			SwarmObserverWarmCombat combat = new SwarmObserverWarmCombat();
+			if (!combat.Read(ctx))
+				return false;
+			
+			CombatStates.Insert(combat);
+		}
+		
+		if (!ctx.Read(count))
+			return false;
+		
+		for (i = 0; i < count; i++)
+		{
+			SwarmObserverWarmCombatLogout combatLogout = new SwarmObserverWarmCombatLogout();
+			if (!combatLogout.Read(ctx))
+				return false;
+			
+			CombatLogouts.Insert(combatLogout);
+		}
+		
+		return true;
+	}
+	
+	// Take the restored combat state of a reconnecting player (each state is handed out once)
+	SwarmObserverWarmCombat TakeCombatState(string steamID)
+	{
+		SwarmObserverWarmCombat combat;
+		if (!m_CombatBySteamID.Find(steamID, combat))
+			return null;
+		
+		m_CombatBySteamID.Remove(steamID);
+		return combat;
+	}
+	
+	// Current UTC time in seconds since 1970-01-01
+	static int GetEpochSeconds()
+	{
+		int year, month, day, hour, minute, second;
+		GetYearMonthDayUTC(year, month, day);
+		GetHourMinuteSecondUTC(hour, minute, second);
+		
+		// Days from civil date (March-based year so the leap day is last)
+		if (month <= 2)
+			year--;
+		
+		int era = year / 400;
+		int yearOfEra = year - era * 400;
+		int dayOfYear = (153 * ((month + 9) % 12) + 2) / 5 + day - 1;
+		int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+		int days = era * 146097 + dayOfEra - 719468;
+		
+		return days * 86400 + hour * 3600 + minute * 60 + second;
+	}
+}
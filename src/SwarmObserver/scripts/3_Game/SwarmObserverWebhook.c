@@ -1,3 +1,4 @@
+#ifndef SWARM_OBSERVER_NO_ZONES
 // Webhook callback handler
 class SwarmObserverWebhookCallback extends RestCallback
 {
@@ -31,9 +32,10 @@ class SwarmObserverWebhook
 	static void SendDisconnectNotification(string steamID, string playerName, string areaName, int timestamp)
 	{
 		SwarmObserverSettings settings = SwarmObserverSettings.GetInstance();
+		SwarmObserverEndpoint endpoint = SwarmObserverSettingsSnapshot.Get().Webhook;
 		
 		// Check if webhook URL is configured
-		if (settings.WebhookURL == "" || settings.WebhookURL.Contains("YOUR_WEBHOOK"))
+		if (!endpoint.Valid)
 		{
 			Print("[SwarmObserver] Webhook URL not configured, skipping notification");
 			return;
@@ -102,40 +104,12 @@ class SwarmObserverWebhook
 		
 		Print("[SwarmObserver] Sending webhook for " + playerName + " (Count: " + violationCount + ")");
 		
-		// Parse webhook URL to extract host and path
-		string webhookURL = settings.WebhookURL;
-		string host = "";
-		string path = "";
-		
-		// Remove https:// or http://
-		if (webhookURL.IndexOf("https://") == 0)
-		{
-			webhookURL = webhookURL.Substring(8, webhookURL.Length() - 8);
-		}
-		else if (webhookURL.IndexOf("http://") == 0)
-		{
-			webhookURL = webhookURL.Substring(7, webhookURL.Length() - 7);
-		}
-		
-		// Split host and path
-		int slashPos = webhookURL.IndexOf("/");
-		if (slashPos > 0)
-		{
-			host = webhookURL.Substring(0, slashPos);
-			path = webhookURL.Substring(slashPos, webhookURL.Length() - slashPos);
-		}
-		else
-		{
-			host = webhookURL;
-			path = "/";
-		}
-		
-		// Send webhook via RestApi
-		RestContext ctx = GetRestApi().GetRestContext("https://" + host);
+		// Send webhook via RestApi (endpoint host and path are parsed once in the settings snapshot)
+		RestContext ctx = GetRestApi().GetRestContext("https://" + endpoint.Host);
 		if (ctx)
 		{
 			ctx.SetHeader("application/json");
-			ctx.POST(new SwarmObserverWebhookCallback(playerName), path, jsonPayload);
+			ctx.POST(new SwarmObserverWebhookCallback(playerName), endpoint.Path, jsonPayload);
 		}
 		else
 		{
@@ -169,3 +143,4 @@ class SwarmObserverWebhook
 		return dayStr + "/" + monthStr + "/" + year.ToString() + " " + hourStr + ":" + minStr + ":" + secStr;
 	}
 }
+#endif
@@ -1,3 +1,4 @@
+#ifndef SWARM_OBSERVER_NO_COMBAT
 // Modded Weapon_Base for shot proximity detection
 modded class Weapon_Base
 {
@@ -10,7 +11,7 @@ modded class Weapon_Base
 			return;
 		
 		// Check if combat logout is enabled
-		SwarmObserverSettings settings = SwarmObserverSettings.GetInstance();
+		SwarmObserverSettingsSnapshot settings = SwarmObserverSettingsSnapshot.Get();
 		if (!settings.CombatLogoutEnabled)
 			return;
 		
@@ -19,8 +20,31 @@ modded class Weapon_Base
 		if (!shooter)
 			return;
 		
+		// Radius depends on how loud this ammo is, and whether a suppressor is attached
+		string suppressorType = "";
+		ItemBase suppressor = GetAttachedSuppressor();
+		if (suppressor)
+			suppressorType = suppressor.GetType();
+		
+		float radius = settings.GetShotRadius(ammoType, suppressorType);
+		if (radius <= 0)
+			return;
+		
+		// Firing direction from the barrel memory points, falling back to the shooter's heading
+		vector muzzlePos = ModelToWorld(GetSelectionPositionMS("usti hlavne"));
+		vector muzzleDir = muzzlePos - ModelToWorld(GetSelectionPositionMS("konec hlavne"));
+		if (muzzleDir.LengthSq() < 0.0001)
+		{
+			muzzlePos = shooter.GetPosition() + "0 1.5 0";
+			muzzleDir = shooter.GetDirection();
+		}
+		muzzleDir.Normalize();
+		
 		// Check proximity to other players
+		int startTicks = TickCount(0);
 		vector shooterPos = shooter.GetPosition();
-		CombatProximityDetector.CheckShotProximity(shooter, shooterPos);
+		CombatProximityDetector.CheckShotProximity(shooter, shooterPos, radius, settings.GetShotTrajectoryRange(ammoType), muzzlePos, muzzleDir);
+		SwarmObserverMetrics.Record(SwarmObserverMetric.SHOT, TickCount(startTicks));
 	}
 }
+#endif
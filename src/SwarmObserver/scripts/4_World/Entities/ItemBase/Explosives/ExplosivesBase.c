@@ -1,4 +1,77 @@
+#ifndef SWARM_OBSERVER_NO_COMBAT
+// Owner attribution for every explosive (grenades, claymores, IEDs, plastic explosives)
+// The owner is the last player to throw, place, arm or remotely trigger the explosive, kept as an identity handle
+// so it survives the owner disconnecting or dying before the explosion.
 modded class ExplosivesBase
 {
-    protected PlayerBase m_Thrower; // Store the player who threw/placed the explosive
-}
\ No newline at end of file
+	protected int m_SwarmObserverOwner;
+	protected bool m_SwarmObserverExploded;
+	
+	// Record the player responsible for this explosive
+	void SetSwarmObserverOwner(EntityAI owner)
+	{
+		PlayerBase player = PlayerBase.Cast(owner);
+		if (player && GetGame().IsServer())
+			m_SwarmObserverOwner = player.GetSwarmObserverHandle();
+	}
+	
+	int GetSwarmObserverOwner()
+	{
+		return m_SwarmObserverOwner;
+	}
+	
+	// Thrown: leaving hands for the ground
+	override void EEItemLocationChanged(notnull InventoryLocation oldLoc, notnull InventoryLocation newLoc)
+	{
+		super.EEItemLocationChanged(oldLoc, newLoc);
+		
+		if (oldLoc.GetType() == InventoryLocationType.HANDS && newLoc.GetType() == InventoryLocationType.GROUND)
+			SetSwarmObserverOwner(oldLoc.GetParent());
+	}
+	
+	// Placed
+	override void OnPlacementComplete(Man player, vector position = "0 0 0", vector orientation = "0 0 0")
+	{
+		super.OnPlacementComplete(player, position, orientation);
+		
+		SetSwarmObserverOwner(player);
+	}
+	
+	// Armed (explosives are armed while held)
+	override void Arm()
+	{
+		super.Arm();
+		
+		SetSwarmObserverOwner(GetHierarchyRootPlayer());
+	}
+	
+	// Remotely triggered: whoever holds the detonator owns the explosion
+	override void OnActivatedByItem(notnull ItemBase item)
+	{
+		SetSwarmObserverOwner(item.GetHierarchyRootPlayer());
+		
+		super.OnActivatedByItem(item);
+	}
+	
+	override void OnExplode()
+	{
+		super.OnExplode();
+		
+		OnSwarmObserverExplode();
+	}
+	
+	// Feed the explosion into the proximity pipeline (once, subclasses may also call this from their own OnExplode)
+	protected void OnSwarmObserverExplode()
+	{
+		if (m_SwarmObserverExploded || m_SwarmObserverOwner == 0 || !GetGame().IsServer())
+			return;
+		
+		m_SwarmObserverExploded = true;
+		
+		int startTicks = TickCount(0);
+		float radius = SwarmObserverSettingsSnapshot.Get().GetExplosiveRadius(GetType(), m_AmmoTypes);
+		CombatProximityDetector.CheckExplosiveProximity(m_SwarmObserverOwner, GetPosition(), radius);
+		SwarmObserverMetrics.Record(SwarmObserverMetric.EXPLOSION, TickCount(startTicks));
+	}
+}
+#endif
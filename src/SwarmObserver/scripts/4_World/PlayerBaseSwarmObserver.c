@@ -10,11 +10,31 @@ modded class PlayerBase
 	// Static variable to pass violation count to menu
 	private static int s_SwarmObserverViolationCount;
 	
+	// Interned identity handle (0 until first resolved, see SwarmObserverIdentityTable)
+	private int m_SwarmObserverHandle;
+	
 	static int GetSwarmObserverViolationCount()
 	{
 		return s_SwarmObserverViolationCount;
 	}
 	
+	// Get the interned identity handle for this player (registered lazily, 0 if no identity)
+	int GetSwarmObserverHandle()
+	{
+		if (m_SwarmObserverHandle == 0 && GetIdentity())
+		{
+			m_SwarmObserverHandle = SwarmObserverIdentityTable.GetInstance().Register(GetIdentity().GetPlainId(), GetIdentity().GetName());
+		}
+		return m_SwarmObserverHandle;
+	}
+	
+	// Give a player without identity a handle of its own (benchmark dummies)
+	void SetSwarmObserverSyntheticIdentity(string steamID, string playerName)
+	{
+		m_SwarmObserverHandle = SwarmObserverIdentityTable.GetInstance().Register(steamID, playerName);
+	}
+	
+	#ifndef SWARM_OBSERVER_NO_ZONES
 	override void OnRPC(PlayerIdentity sender, int rpc_type, ParamsReadContext ctx)
 	{
 		super.OnRPC(sender, rpc_type, ctx);
@@ -56,7 +76,9 @@ modded class PlayerBase
 			}
 		}
 	}
+	#endif
 	
+	#ifndef SWARM_OBSERVER_NO_COMBAT
 	// Combat detection - override EEHitBy to detect damage
 	override void EEHitBy(TotalDamageResult damageResult, int damageType, EntityAI source, int component, string dmgZone, string ammo, vector modelPos, float speedCoef)
 	{		
@@ -67,8 +89,7 @@ modded class PlayerBase
 		}
 		
 		// Check if combat logout is enabled
-		SwarmObserverSettings settings = SwarmObserverSettings.GetInstance();
-		if (!settings.CombatLogoutEnabled) {
+		if (!SwarmObserverSettingsSnapshot.Get().CombatLogoutEnabled) {
 			super.EEHitBy(damageResult, damageType, source, component, dmgZone, ammo, modelPos, speedCoef);
 			return;
 		}
@@ -80,17 +101,28 @@ modded class PlayerBase
 			
 			// Only register if attacker is a different player
 			if (attacker && attacker != this)
-			{
-				// Register combat action for victim (receiving damage)
-				GetCombatStateManager().RegisterCombatAction(this, attacker, "DAMAGE_RECEIVED", ammo);
-				
-				// Register combat action for attacker (dealing damage)
-				GetCombatStateManager().RegisterCombatAction(attacker, this, "DAMAGE_DEALT", ammo);
-			}
+				OnSwarmObserverHit(attacker, ammo);
 		}
 
 		super.EEHitBy(damageResult, damageType, source, component, dmgZone, ammo, modelPos, speedCoef);
 	}
+	
+	// Register a player vs player hit on both sides (EEHitBy, and the benchmark's synthetic hits)
+	void OnSwarmObserverHit(PlayerBase attacker, string ammo)
+	{
+		int startTicks = TickCount(0);
+		
+		// Intern the ammo type once for both records
+		int ammoHandle = SwarmObserverAmmoTable.GetInstance().Intern(ammo);
+		
+		// Register combat action for victim (receiving damage)
+		GetCombatStateManager().RegisterCombatAction(this, attacker, CombatActionType.DAMAGE_RECEIVED, ammoHandle);
+		
+		// Register combat action for attacker (dealing damage)
+		GetCombatStateManager().RegisterCombatAction(attacker, this, CombatActionType.DAMAGE_DEALT, ammoHandle);
+		
+		SwarmObserverMetrics.Record(SwarmObserverMetric.HIT, TickCount(startTicks));
+	}
 
 	override void EEKilled(Object killer)
 	{
@@ -101,8 +133,7 @@ modded class PlayerBase
 		}
 		
 		// Check if combat logout is enabled
-		SwarmObserverSettings settings = SwarmObserverSettings.GetInstance();
-		if (!settings.CombatLogoutEnabled) {
+		if (!SwarmObserverSettingsSnapshot.Get().CombatLogoutEnabled) {
 			super.EEKilled(killer);
 			return;
 		}
@@ -112,4 +143,5 @@ modded class PlayerBase
 
 		super.EEKilled(killer);
 	}
+	#endif
 }
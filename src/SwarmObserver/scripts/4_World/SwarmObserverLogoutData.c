@@ -4,18 +4,22 @@ class SwarmObserverLogoutData
 	string PlayerName;
 	vector Position;
 	string RestrictedAreaName;
+	string SteamID;
+	int StoredAt; // Used to evict the oldest entries once MaxLogoutData is reached
+	
+	#ifndef SWARM_OBSERVER_NO_COMBAT
+	// Combat data (filled in by the caller when the player was in combat)
 	bool WasInCombat;
 	ref CombatState CombatStateData;
-	string SteamID;
+	#endif
 	
-	void SwarmObserverLogoutData(string playerName, string steamId, vector pos, string areaName, bool inCombat, CombatState combatState)
+	void SwarmObserverLogoutData(string playerName, string steamId, vector pos, string areaName)
 	{
 		PlayerName = playerName;
         SteamID = steamId;
 		Position = pos;
 		RestrictedAreaName = areaName;
-		WasInCombat = inCombat;
-		CombatStateData = combatState;
+		StoredAt = GetGame().GetTime();
 	}
 }
 
@@ -40,11 +44,17 @@ class SwarmObserverLogoutManager
 	}
 	
 	// Store logout data when disconnect is initiated (keyed by Steam ID)
-	static void StoreLogoutData(string uid, string steamId, string playerName, vector pos, string areaName, bool inCombat, CombatState combatState)
+	static SwarmObserverLogoutData StoreLogoutData(string uid, string steamId, string playerName, vector pos, string areaName)
 	{
 		SwarmObserverLogoutManager manager = GetInstance();
-		SwarmObserverLogoutData data = new SwarmObserverLogoutData(playerName, steamId, pos, areaName, inCombat, combatState);
+		
+		// Entries are normally removed in PlayerDisconnected, the cap only catches the ones that never got there
+		if (!manager.m_LogoutData.Contains(uid) && manager.m_LogoutData.Count() >= SwarmObserverSettingsSnapshot.Get().MaxLogoutData)
+			manager.EvictOldest();
+		
+		SwarmObserverLogoutData data = new SwarmObserverLogoutData(playerName, steamId, pos, areaName);
 		manager.m_LogoutData.Set(uid, data);
+		return data;
 	}
 	
 	// Get stored logout data by Steam ID
@@ -64,4 +74,43 @@ class SwarmObserverLogoutManager
 		SwarmObserverLogoutManager manager = GetInstance();
 		manager.m_LogoutData.Remove(uid);
 	}
+	
+	// Drop the oldest stored entry (cap reached)
+	private void EvictOldest()
+	{
+		string oldestUid;
+		int oldestTime = int.MAX;
+		foreach (string uid, SwarmObserverLogoutData data : m_LogoutData)
+		{
+			if (data.StoredAt < oldestTime)
+			{
+				oldestTime = data.StoredAt;
+				oldestUid = uid;
+			}
+		}
+		
+		Print("[SwarmObserver] Logout data cap reached (" + m_LogoutData.Count() + "), evicting oldest entry");
+		m_LogoutData.Remove(oldestUid);
+	}
+	
+	static int GetCount()
+	{
+		return GetInstance().m_LogoutData.Count();
+	}
+	
+	// Estimated memory use (includes the attached combat states, they are no longer in the combat state manager)
+	static int GetEstimatedBytes()
+	{
+		int bytes = 0;
+		foreach (string uid, SwarmObserverLogoutData data : GetInstance().m_LogoutData)
+		{
+			bytes += 2 * SwarmObserverConstants.MEMORY_OBJECT_BYTES + SwarmObserverMemoryReport.StringBytes(uid) + SwarmObserverMemoryReport.StringBytes(data.PlayerName) + SwarmObserverMemoryReport.StringBytes(data.SteamID) + SwarmObserverMemoryReport.StringBytes(data.RestrictedAreaName);
+			
+			#ifndef SWARM_OBSERVER_NO_COMBAT
+			if (data.CombatStateData)
+				bytes += data.CombatStateData.GetEstimatedBytes();
+			#endif
+		}
+		return bytes;
+	}
 }
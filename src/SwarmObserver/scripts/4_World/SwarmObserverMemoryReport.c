@@ -0,0 +1,19 @@
+// World stores in the memory report
+modded class SwarmObserverMemoryReport
+{
+	override void Collect()
+	{
+		super.Collect();
+		
+		SwarmObserverSettingsSnapshot settings = SwarmObserverSettingsSnapshot.Get();
+		AddStore("Logout data", SwarmObserverLogoutManager.GetCount(), settings.MaxLogoutData, SwarmObserverLogoutManager.GetEstimatedBytes());
+		
+		#ifndef SWARM_OBSERVER_NO_COMBAT
+		CombatStateManager combatManager = GetCombatStateManager();
+		AddStore("Combat states", combatManager.GetActiveCombatCount(), settings.MaxCombatStates, combatManager.GetEstimatedBytes());
+		
+		// Bounded by CombatLogoutDedupeSeconds rather than a cap
+		AddStore("Combat logouts", CombatLogoutGraceManager.GetCount(), 0, CombatLogoutGraceManager.GetEstimatedBytes());
+		#endif
+	}
+}
@@ -1,39 +1,45 @@
+#ifndef SWARM_OBSERVER_NO_COMBAT
+// Combat action types
+enum CombatActionType
+{
+	DAMAGE_RECEIVED,
+	DAMAGE_DEALT,
+	SHOT_NEAR_PLAYER,
+	SHOT_NEARBY,
+	EXPLOSIVE_NEAR_PLAYER,
+	EXPLOSIVE_NEARBY,
+	SHOT_AT_PLAYER,
+	SHOT_AT_BY
+}
+
 // Individual combat action record
+// Only small integers are stored: the other player is an identity handle and the damage type an ammo table handle
 class CombatAction
 {
 	int m_Timestamp;
-	string m_ActionType;
-	string m_OtherPlayerName;
-	string m_OtherPlayerID;
-	string m_DamageType;
+	int m_ActionType;
+	int m_OtherPlayer;
+	int m_DamageType;
 	float m_Distance;
 	vector m_Position;
 	
-	void CombatAction(string actionType, PlayerBase otherPlayer, string damageType, vector position)
+	void CombatAction(int actionType, int otherPlayer, int damageType, vector position, float distance)
 	{
 		m_Timestamp = GetGame().GetTime();
 		m_ActionType = actionType;
+		m_OtherPlayer = otherPlayer;
 		m_DamageType = damageType;
 		m_Position = position;
-		
-		if (otherPlayer && otherPlayer.GetIdentity())
-		{
-			m_OtherPlayerName = otherPlayer.GetIdentity().GetName();
-			m_OtherPlayerID = otherPlayer.GetIdentity().GetPlainId();
-			m_Distance = vector.Distance(position, otherPlayer.GetPosition());
-		}
-		else
-		{
-			m_OtherPlayerName = "";
-			m_OtherPlayerID = "";
-			m_Distance = 0;
-		}
+		m_Distance = distance;
 	}
 	
-	// Get formatted string for debugging
+	// Get formatted string for debugging (strings are resolved here only)
 	string GetActionString()
 	{
+		string otherName = SwarmObserverIdentityTable.GetInstance().GetName(m_OtherPlayer);
+		string damageType = SwarmObserverAmmoTable.GetInstance().Resolve(m_DamageType);
 		return string.Format("[%1] %2 -> %3 (distance: %4m, damage: %5)", 
-			m_Timestamp, m_ActionType, m_OtherPlayerName, m_Distance, m_DamageType);
+			m_Timestamp, typename.EnumToString(CombatActionType, m_ActionType), otherName, m_Distance, damageType);
 	}
 }
+#endif
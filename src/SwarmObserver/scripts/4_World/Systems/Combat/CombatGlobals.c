@@ -1,3 +1,4 @@
+#ifndef SWARM_OBSERVER_NO_COMBAT
 // Global accessor functions for combat system
 // Following the existing singleton pattern from SwarmObserverModule
 
@@ -12,3 +13,4 @@ SwarmObserverSettings GetCombatSettings()
 {
 	return SwarmObserverSettings.GetInstance();
 }
+#endif
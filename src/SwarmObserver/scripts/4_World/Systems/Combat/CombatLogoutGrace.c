@@ -0,0 +1,233 @@
+#ifndef SWARM_OBSERVER_NO_COMBAT
+// Pending combat logout for a player
+class CombatLogoutGraceData
+{
+	string SteamID;
+	string PlayerName;
+	vector Position;
+	ref CombatState State;
+	int DisconnectTimestamp;
+	int WindowStartTimestamp; // First logout of the dedupe window
+	int LogoutCount;          // Combat logouts within the dedupe window
+	bool Pending;             // Alert still due (false once the player reconnected)
+	bool AlertSent;           // The window's alert went out, later logouts in the window are only counted
+	
+	void CombatLogoutGraceData(string steamID)
+	{
+		SteamID = steamID;
+		WindowStartTimestamp = GetGame().GetTime();
+		LogoutCount = 0;
+		Pending = false;
+		AlertSent = false;
+	}
+}
+
+// Combat logout grace manager singleton
+// Alerts are deferred by CombatLogoutGraceSeconds and dropped if the player reconnects in time.
+// Logouts from the same player within CombatLogoutDedupeSeconds collapse into a single alert with a count.
+// An entry whose alert was sent stays until its window closes, so a repeat inside the window never alerts again.
+class CombatLogoutGraceManager
+{
+	private static ref CombatLogoutGraceManager s_Instance;
+	private ref map<string, ref CombatLogoutGraceData> m_Entries;
+	private bool m_TimerRunning;
+	
+	void CombatLogoutGraceManager()
+	{
+		m_Entries = new map<string, ref CombatLogoutGraceData>;
+		m_TimerRunning = false;
+	}
+	
+	// Get singleton instance
+	static CombatLogoutGraceManager GetInstance()
+	{
+		if (!s_Instance)
+		{
+			s_Instance = new CombatLogoutGraceManager();
+		}
+		return s_Instance;
+	}
+	
+	// Register a combat logout (called when a player in combat disconnects)
+	static void StartCombatLogout(string steamID, string playerName, vector pos, CombatState state)
+	{
+		CombatLogoutGraceManager manager = GetInstance();
+		int currentTime = GetGame().GetTime();
+		
+		CombatLogoutGraceData data;
+		if (!manager.m_Entries.Find(steamID, data) || currentTime - data.WindowStartTimestamp > SwarmObserverSettingsSnapshot.Get().CombatLogoutDedupeMs)
+		{
+			data = new CombatLogoutGraceData(steamID);
+			manager.m_Entries.Set(steamID, data);
+		}
+		
+		// Latest logout wins for the evidence, the count covers the whole window
+		data.PlayerName = playerName;
+		data.Position = pos;
+		data.DisconnectTimestamp = currentTime;
+		data.LogoutCount++;
+		
+		// The window already alerted, this logout is only counted
+		if (data.AlertSent)
+		{
+			Print("[SwarmObserver] Combat logout for " + playerName + " (" + steamID + ") collapsed into the alert already sent, logouts in window: " + data.LogoutCount);
+			return;
+		}
+		
+		data.State = state;
+		data.Pending = true;
+		
+		Print("[SwarmObserver] Combat logout grace started for " + playerName + " (" + steamID + "), logouts in window: " + data.LogoutCount);
+		
+		// Single timer for all pending combat logouts
+		if (!manager.m_TimerRunning)
+		{
+			manager.m_TimerRunning = true;
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(manager.CheckExpiredCombatLogouts, SwarmObserverConstants.COMBAT_LOGOUT_GRACE_POLL_MS, true);
+		}
+	}
+	
+	// Cancel a pending alert (player reconnected in time). The logout still counts towards the dedupe window.
+	static bool CancelCombatLogout(string steamID)
+	{
+		CombatLogoutGraceData data;
+		if (!GetInstance().m_Entries.Find(steamID, data) || !data.Pending)
+			return false;
+		
+		data.Pending = false;
+		data.State = null;
+		Print("[SwarmObserver] Combat logout grace cancelled for " + data.PlayerName + " - reconnected in time");
+		return true;
+	}
+	
+	// Check pending alerts and drop entries whose dedupe window has closed
+	void CheckExpiredCombatLogouts()
+	{
+		SwarmObserverSettingsSnapshot settings = SwarmObserverSettingsSnapshot.Get();
+		int currentTime = GetGame().GetTime();
+		
+		array<string> finished = new array<string>;
+		
+		foreach (string steamID, CombatLogoutGraceData data : m_Entries)
+		{
+			if (data.Pending)
+			{
+				if (currentTime - data.DisconnectTimestamp >= settings.CombatLogoutGraceMs)
+				{
+					Print("[SwarmObserver] Combat logout grace expired for " + data.PlayerName + " (" + steamID + ")");
+					CombatWebhook.SendCombatLogoutNotification(steamID, data.PlayerName, data.Position, data.State, data.DisconnectTimestamp, data.LogoutCount);
+					
+					// Keep the entry until the dedupe window closes
+					data.Pending = false;
+					data.AlertSent = true;
+					data.State = null;
+				}
+			}
+			else if (currentTime - data.WindowStartTimestamp > settings.CombatLogoutDedupeMs)
+			{
+				finished.Insert(steamID);
+			}
+		}
+		
+		foreach (string finishedSteamID : finished)
+		{
+			m_Entries.Remove(finishedSteamID);
+		}
+		
+		// If there is nothing left to track, stop the repeating timer
+		if (m_Entries.Count() == 0 && m_TimerRunning)
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(CheckExpiredCombatLogouts);
+			m_TimerRunning = false;
+		}
+	}
+	
+	// Add pending alerts and open dedupe windows to the warm restart snapshot
+	static void ExportWarmState(SwarmObserverWarmState warmState)
+	{
+		int currentTime = GetGame().GetTime();
+		foreach (string steamID, CombatLogoutGraceData data : GetInstance().m_Entries)
+		{
+			SwarmObserverWarmCombatLogout entry = new SwarmObserverWarmCombatLogout();
+			entry.SteamID = steamID;
+			entry.PlayerName = data.PlayerName;
+			entry.Position = data.Position;
+			entry.DisconnectAgeMs = currentTime - data.DisconnectTimestamp;
+			entry.WindowAgeMs = currentTime - data.WindowStartTimestamp;
+			entry.LogoutCount = data.LogoutCount;
+			entry.Pending = data.Pending;
+			entry.AlertSent = data.AlertSent;
+			
+			if (data.Pending && data.State)
+			{
+				entry.State = new SwarmObserverWarmCombat();
+				entry.State.SteamID = steamID;
+				data.State.ExportWarmState(entry.State, currentTime);
+			}
+			
+			warmState.CombatLogouts.Insert(entry);
+		}
+	}
+	
+	// Restore entries from the warm restart snapshot (called once on startup)
+	static void RestoreWarmState(SwarmObserverWarmState warmState)
+	{
+		if (!warmState || warmState.CombatLogouts.Count() == 0)
+			return;
+		
+		CombatLogoutGraceManager manager = GetInstance();
+		int currentTime = GetGame().GetTime();
+		
+		foreach (SwarmObserverWarmCombatLogout entry : warmState.CombatLogouts)
+		{
+			CombatLogoutGraceData data = new CombatLogoutGraceData(entry.SteamID);
+			data.PlayerName = entry.PlayerName;
+			data.Position = entry.Position;
+			data.DisconnectTimestamp = currentTime - entry.DisconnectAgeMs;
+			data.WindowStartTimestamp = currentTime - entry.WindowAgeMs;
+			data.LogoutCount = entry.LogoutCount;
+			data.Pending = entry.Pending && entry.State != null;
+			data.AlertSent = entry.AlertSent;
+			
+			if (data.Pending)
+			{
+				data.State = new CombatState();
+				data.State.ImportWarmState(entry.State, currentTime);
+			}
+			
+			manager.m_Entries.Set(entry.SteamID, data);
+		}
+		
+		if (!manager.m_TimerRunning)
+		{
+			manager.m_TimerRunning = true;
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(manager.CheckExpiredCombatLogouts, SwarmObserverConstants.COMBAT_LOGOUT_GRACE_POLL_MS, true);
+		}
+	}
+	
+	static int GetCount()
+	{
+		return GetInstance().m_Entries.Count();
+	}
+	
+	// Estimated memory use (pending entries keep their combat state)
+	static int GetEstimatedBytes()
+	{
+		int bytes = 0;
+		foreach (string steamID, CombatLogoutGraceData data : GetInstance().m_Entries)
+		{
+			bytes += 2 * SwarmObserverConstants.MEMORY_OBJECT_BYTES + 2 * SwarmObserverMemoryReport.StringBytes(steamID) + SwarmObserverMemoryReport.StringBytes(data.PlayerName);
+			if (data.State)
+				bytes += data.State.GetEstimatedBytes();
+		}
+		return bytes;
+	}
+	
+	// Check if player has a pending combat logout alert
+	static bool HasPendingCombatLogout(string steamID)
+	{
+		CombatLogoutGraceData data;
+		return GetInstance().m_Entries.Find(steamID, data) && data.Pending;
+	}
+}
+#endif
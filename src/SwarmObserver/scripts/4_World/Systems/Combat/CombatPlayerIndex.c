@@ -0,0 +1,239 @@
+#ifndef SWARM_OBSERVER_NO_COMBAT
+// Spatial index of connected players for combat queries
+// Uniform grid rebuilt lazily from GetGame().GetPlayers() at most every PLAYER_INDEX_REFRESH_MS.
+// Benchmark dummies have no identity and are not in the player list, so they are added explicitly.
+// Cells only select candidates: callers test the live position, and queries are padded by
+// PLAYER_INDEX_MARGIN to cover players that moved since the last rebuild.
+class CombatPlayerIndex
+{
+	private static ref CombatPlayerIndex s_Instance;
+	private ref array<Man> m_Players;
+	private ref map<int, ref array<PlayerBase>> m_Cells;
+	private ref map<int, PlayerBase> m_ByHandle;
+	private ref array<PlayerBase> m_SyntheticPlayers;
+	private int m_LastBuildTime;
+	private bool m_Built;
+	
+	void CombatPlayerIndex()
+	{
+		m_Players = new array<Man>;
+		m_Cells = new map<int, ref array<PlayerBase>>;
+		m_ByHandle = new map<int, PlayerBase>;
+		m_SyntheticPlayers = new array<PlayerBase>;
+		m_LastBuildTime = 0;
+		m_Built = false;
+	}
+	
+	// Get singleton instance
+	static CombatPlayerIndex GetInstance()
+	{
+		if (!s_Instance)
+		{
+			s_Instance = new CombatPlayerIndex();
+		}
+		return s_Instance;
+	}
+	
+	// Collect players whose cell overlaps the box (x/z bounds in world meters)
+	void QueryBox(float minX, float minZ, float maxX, float maxZ, array<PlayerBase> results)
+	{
+		Refresh();
+		
+		float margin = SwarmObserverConstants.PLAYER_INDEX_MARGIN;
+		int minCellX = GetCellCoord(minX - margin);
+		int maxCellX = GetCellCoord(maxX + margin);
+		int minCellZ = GetCellCoord(minZ - margin);
+		int maxCellZ = GetCellCoord(maxZ + margin);
+		
+		// A box covering more cells than there are players is cheaper to answer with a plain scan
+		if ((maxCellX - minCellX + 1) * (maxCellZ - minCellZ + 1) >= m_Players.Count())
+		{
+			ScanAll(results);
+			return;
+		}
+		
+		for (int x = minCellX; x <= maxCellX; x++)
+		{
+			for (int z = minCellZ; z <= maxCellZ; z++)
+			{
+				AddCellPlayers(GetCellKey(x, z), results);
+			}
+		}
+	}
+	
+	// Collect players whose cell overlaps the box or lies within radius of the segment from-to (x/z only)
+	// Only the cells along the segment are visited, so a long diagonal shot costs the cells it crosses rather than
+	// its bounding box. Cells are collected as a set first, so a player near both the box and the segment is returned once.
+	void QueryBoxAndSegment(float minX, float minZ, float maxX, float maxZ, vector from, vector to, float radius, array<PlayerBase> results)
+	{
+		Refresh();
+		
+		float margin = SwarmObserverConstants.PLAYER_INDEX_MARGIN;
+		int minCellX = GetCellCoord(minX - margin);
+		int maxCellX = GetCellCoord(maxX + margin);
+		int minCellZ = GetCellCoord(minZ - margin);
+		int maxCellZ = GetCellCoord(maxZ + margin);
+		
+		map<int, bool> keys = new map<int, bool>;
+		for (int x = minCellX; x <= maxCellX; x++)
+		{
+			for (int z = minCellZ; z <= maxCellZ; z++)
+			{
+				keys.Set(GetCellKey(x, z), true);
+			}
+		}
+		
+		AddSegmentCells(from, to, radius + margin, keys);
+		
+		if (keys.Count() >= m_Players.Count())
+		{
+			ScanAll(results);
+			return;
+		}
+		
+		foreach (int key, bool unused : keys)
+		{
+			AddCellPlayers(key, results);
+		}
+	}
+	
+	// Find a connected player by identity handle (null if not connected)
+	PlayerBase FindPlayer(int handle)
+	{
+		Refresh();
+		
+		PlayerBase player;
+		if (!m_ByHandle.Find(handle, player))
+			return null;
+		
+		return player;
+	}
+	
+	// Index a player that is not in GetGame().GetPlayers() (it needs a synthetic identity handle)
+	void AddSyntheticPlayer(PlayerBase player)
+	{
+		m_SyntheticPlayers.Insert(player);
+		m_Built = false;
+	}
+	
+	void ClearSyntheticPlayers()
+	{
+		m_SyntheticPlayers.Clear();
+		m_Built = false;
+	}
+	
+	// Alive and with an identity handle (corpses and identity-less players never take part in combat)
+	private static bool IsIndexable(PlayerBase player)
+	{
+		return player && player.GetSwarmObserverHandle() != 0 && player.IsAlive();
+	}
+	
+	// Add the cells within expand of the segment, one cell column at a time
+	// Each column takes the part of the segment whose x lies in the column (widened by expand) and adds the cells
+	// between the z extremes of that part, also widened by expand
+	private static void AddSegmentCells(vector from, vector to, float expand, map<int, bool> keys)
+	{
+		float cellSize = SwarmObserverConstants.PLAYER_INDEX_CELL_SIZE;
+		float dx = to[0] - from[0];
+		float dz = to[2] - from[2];
+		
+		int firstColumn = GetCellCoord(Math.Min(from[0], to[0]) - expand);
+		int lastColumn = GetCellCoord(Math.Max(from[0], to[0]) + expand);
+		for (int column = firstColumn; column <= lastColumn; column++)
+		{
+			float t0 = 0;
+			float t1 = 1;
+			if (Math.AbsFloat(dx) > 0.001)
+			{
+				float enter = (column * cellSize - expand - from[0]) / dx;
+				float leave = ((column + 1) * cellSize + expand - from[0]) / dx;
+				t0 = Math.Max(Math.Min(enter, leave), 0);
+				t1 = Math.Min(Math.Max(enter, leave), 1);
+				if (t0 > t1)
+					continue;
+			}
+			
+			float z0 = from[2] + dz * t0;
+			float z1 = from[2] + dz * t1;
+			int lastRow = GetCellCoord(Math.Max(z0, z1) + expand);
+			for (int row = GetCellCoord(Math.Min(z0, z1) - expand); row <= lastRow; row++)
+			{
+				keys.Set(GetCellKey(column, row), true);
+			}
+		}
+	}
+	
+	private void ScanAll(array<PlayerBase> results)
+	{
+		foreach (Man man : m_Players)
+		{
+			PlayerBase player = PlayerBase.Cast(man);
+			if (IsIndexable(player))
+				results.Insert(player);
+		}
+	}
+	
+	private void AddCellPlayers(int key, array<PlayerBase> results)
+	{
+		array<PlayerBase> cell;
+		if (!m_Cells.Find(key, cell))
+			return;
+		
+		foreach (PlayerBase cellPlayer : cell)
+		{
+			// May have died since the last rebuild
+			if (IsIndexable(cellPlayer))
+				results.Insert(cellPlayer);
+		}
+	}
+	
+	// Rebuild the grid if it is older than the refresh interval
+	private void Refresh()
+	{
+		int currentTime = GetGame().GetTime();
+		if (m_Built && currentTime - m_LastBuildTime < SwarmObserverConstants.PLAYER_INDEX_REFRESH_MS)
+			return;
+		
+		m_Built = true;
+		m_LastBuildTime = currentTime;
+		m_Players.Clear();
+		m_Cells.Clear();
+		m_ByHandle.Clear();
+		
+		GetGame().GetPlayers(m_Players);
+		foreach (PlayerBase syntheticPlayer : m_SyntheticPlayers)
+		{
+			if (syntheticPlayer)
+				m_Players.Insert(syntheticPlayer);
+		}
+		
+		foreach (Man man : m_Players)
+		{
+			PlayerBase player = PlayerBase.Cast(man);
+			if (!IsIndexable(player))
+				continue;
+			
+			vector pos = player.GetPosition();
+			int key = GetCellKey(GetCellCoord(pos[0]), GetCellCoord(pos[2]));
+			array<PlayerBase> cell;
+			if (!m_Cells.Find(key, cell))
+			{
+				cell = new array<PlayerBase>;
+				m_Cells.Set(key, cell);
+			}
+			cell.Insert(player);
+			m_ByHandle.Set(player.GetSwarmObserverHandle(), player);
+		}
+	}
+	
+	private static int GetCellCoord(float value)
+	{
+		return Math.Floor(value / SwarmObserverConstants.PLAYER_INDEX_CELL_SIZE);
+	}
+	
+	private static int GetCellKey(int x, int z)
+	{
+		return (x << 16) ^ (z & 0xFFFF);
+	}
+}
+#endif
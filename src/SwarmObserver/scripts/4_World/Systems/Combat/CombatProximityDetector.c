@@ -1,109 +1,121 @@
+#ifndef SWARM_OBSERVER_NO_COMBAT
 // Combat proximity detection helper
 class CombatProximityDetector
 {
 	private static int s_LastShotTime = 0;
-	private static string s_LastShooterID = "";
+	private static int s_LastShooter = 0;
 	
-	// Check for nearby players when a shot is fired
-	static void CheckShotProximity(PlayerBase shooter, vector shotPosition)
+	// Check for players near a shot and players along its path, in a single pass over the player index
+	// radius is the weapon's audible radius around the shooter, range the ammo's trajectory length (GetShotTrajectoryRange),
+	// muzzlePosition/muzzleDirection the bullet's origin and heading
+	static void CheckShotProximity(PlayerBase shooter, vector shotPosition, float radius, float range, vector muzzlePosition, vector muzzleDirection)
 	{
 		if (!shooter || !GetGame().IsServer())
 			return;
 		
-		SwarmObserverSettings settings = SwarmObserverSettings.GetInstance();
+		SwarmObserverSettingsSnapshot settings = SwarmObserverSettingsSnapshot.Get();
 		if (!settings.CombatLogoutEnabled)
 			return;
 		
 		// Prevent rapid duplicate checks (debounce 50ms per shooter to filter same-shot duplicates)
 		int currentTime = GetGame().GetTime();
-		string shooterID = shooter.GetIdentity().GetPlainId();
-		if (currentTime - s_LastShotTime < 50 && shooterID == s_LastShooterID)
+		int shooterHandle = shooter.GetSwarmObserverHandle();
+		if (currentTime - s_LastShotTime < 50 && shooterHandle == s_LastShooter)
 		{
 			return; // Skip duplicate check for same shot
 		}
 		s_LastShotTime = currentTime;
-		s_LastShooterID = shooterID;
+		s_LastShooter = shooterHandle;
 		
-		float radius = settings.ShotProximityRadius;
-		array<Man> players = new array<Man>();
-		array<Object> objects = new array<Object>();
-		array<CargoBase> proxyCargos = new array<CargoBase>();
+		float radiusSq = radius * radius;
 		
-		// Get all objects in radius
-		GetGame().GetObjectsAtPosition(shotPosition, radius, objects, proxyCargos);
+		// Trajectory capsule: segment from the muzzle along the firing direction, ShotTrajectoryRadius thick
+		float capsuleRadius = settings.ShotTrajectoryRadius;
+		float capsuleRadiusSq = capsuleRadius * capsuleRadius;
+		vector trajectoryEnd = muzzlePosition + muzzleDirection * range;
 		
-		// Find nearby players
-		foreach (Object obj : objects)
+		// Candidates: the audible sphere's box plus only the cells along the capsule
+		array<PlayerBase> candidates = new array<PlayerBase>();
+		CombatPlayerIndex.GetInstance().QueryBoxAndSegment(shotPosition[0] - radius, shotPosition[2] - radius, shotPosition[0] + radius, shotPosition[2] + radius, muzzlePosition, trajectoryEnd, capsuleRadius, candidates);
+		
+		foreach (PlayerBase nearbyPlayer : candidates)
 		{
-			PlayerBase nearbyPlayer = PlayerBase.Cast(obj);
-			if (nearbyPlayer && nearbyPlayer != shooter && nearbyPlayer.GetIdentity())
+			if (nearbyPlayer == shooter || nearbyPlayer.GetSwarmObserverHandle() == 0)
+				continue;
+			
+			vector playerPos = nearbyPlayer.GetPosition();
+			
+			// Closest point on the trajectory (players behind the muzzle are never shot at)
+			float along = vector.Dot(playerPos - muzzlePosition, muzzleDirection);
+			if (range > 0 && along > 0 && along <= range && vector.DistanceSq(playerPos, muzzlePosition + muzzleDirection * along) <= capsuleRadiusSq)
 			{
-				float distance = vector.Distance(shotPosition, nearbyPlayer.GetPosition());
-				if (distance <= radius)
+				GetCombatStateManager().RegisterCombatAction(shooter, nearbyPlayer, CombatActionType.SHOT_AT_PLAYER);
+				GetCombatStateManager().RegisterCombatAction(nearbyPlayer, shooter, CombatActionType.SHOT_AT_BY);
+				
+				if (settings.CombatDebugMode)
 				{
-					// Register combat for both shooter and nearby player
-					GetCombatStateManager().RegisterCombatAction(shooter, nearbyPlayer, "SHOT_NEAR_PLAYER", "");
-					GetCombatStateManager().RegisterCombatAction(nearbyPlayer, shooter, "SHOT_NEARBY", "");
-					
-					if (settings.CombatDebugMode)
-					{
-						Print(string.Format("[SwarmObserver] Shot proximity: %1 fired near %2 (distance: %3m)",
-							shooter.GetIdentity().GetName(), 
-							nearbyPlayer.GetIdentity().GetName(),
-							distance));
-					}
+					Print(string.Format("[SwarmObserver] Shot at: %1 fired at %2 (distance: %3m)",
+						SwarmObserverIdentityTable.GetInstance().GetName(shooterHandle), 
+						SwarmObserverIdentityTable.GetInstance().GetName(nearbyPlayer.GetSwarmObserverHandle()),
+						along));
+				}
+			}
+			else if (vector.DistanceSq(shotPosition, playerPos) <= radiusSq)
+			{
+				// Register combat for both shooter and nearby player
+				GetCombatStateManager().RegisterCombatAction(shooter, nearbyPlayer, CombatActionType.SHOT_NEAR_PLAYER);
+				GetCombatStateManager().RegisterCombatAction(nearbyPlayer, shooter, CombatActionType.SHOT_NEARBY);
+				
+				if (settings.CombatDebugMode)
+				{
+					Print(string.Format("[SwarmObserver] Shot proximity: %1 fired near %2 (distance: %3m)",
+						SwarmObserverIdentityTable.GetInstance().GetName(shooterHandle), 
+						SwarmObserverIdentityTable.GetInstance().GetName(nearbyPlayer.GetSwarmObserverHandle()),
+						vector.Distance(shotPosition, playerPos)));
 				}
 			}
 		}
 	}
 	
-	// Override grenade base to get the player who threw it and call CheckExplosiveProximity when it explodes/lands
-	// Yes DayZ being DayZ, they did not implemented anything to know who threw a grenade c: c: c: c: c:
-	// Check for nearby players when an explosive is thrown/placed
-	static void CheckExplosiveProximity(PlayerBase thrower, vector explosivePosition)
+	// Check for nearby players when an explosive goes off
+	// ownerHandle is the identity handle of the player who threw, placed or triggered it (the owner may be offline)
+	static void CheckExplosiveProximity(int ownerHandle, vector explosivePosition, float radius)
 	{
-		if (!thrower || !GetGame().IsServer())
+		if (ownerHandle == 0 || radius <= 0 || !GetGame().IsServer())
 			return;
 		
-		Print(string.Format("[SwarmObserver] Checking explosive proximity for %1 at position %2", 
-			thrower.GetIdentity().GetName(), explosivePosition));
-
-		SwarmObserverSettings settings = SwarmObserverSettings.GetInstance();
+		SwarmObserverSettingsSnapshot settings = SwarmObserverSettingsSnapshot.Get();
 		if (!settings.CombatLogoutEnabled)
 			return;
 		
-		float radius = settings.ExplosiveProximityRadius;
-		array<Man> players = new array<Man>();
-		array<Object> objects = new array<Object>();
-		array<CargoBase> proxyCargos = new array<CargoBase>();
-
-		Print(string.Format("[SwarmObserver] Searching for objects near explosive (radius: %1m)", radius));
+		float radiusSq = radius * radius;
+		PlayerBase owner = CombatPlayerIndex.GetInstance().FindPlayer(ownerHandle);
 		
-		// Get all objects in radius
-		GetGame().GetObjectsAtPosition(explosivePosition, radius, objects, proxyCargos);
+		array<PlayerBase> candidates = new array<PlayerBase>();
+		CombatPlayerIndex.GetInstance().QueryBox(explosivePosition[0] - radius, explosivePosition[2] - radius, explosivePosition[0] + radius, explosivePosition[2] + radius, candidates);
 		
-		// Find nearby players
-		foreach (Object obj : objects)
+		foreach (PlayerBase nearbyPlayer : candidates)
 		{
-			PlayerBase nearbyPlayer = PlayerBase.Cast(obj);
-			if (nearbyPlayer && nearbyPlayer != thrower && nearbyPlayer.GetIdentity())
+			int nearbyHandle = nearbyPlayer.GetSwarmObserverHandle();
+			if (nearbyHandle == 0 || nearbyHandle == ownerHandle)
+				continue;
+			
+			if (vector.DistanceSq(explosivePosition, nearbyPlayer.GetPosition()) > radiusSq)
+				continue;
+			
+			// Register combat for the owner (if still connected) and the nearby player
+			if (owner)
+				GetCombatStateManager().RegisterCombatAction(owner, nearbyPlayer, CombatActionType.EXPLOSIVE_NEAR_PLAYER);
+			GetCombatStateManager().RegisterCombatActionByHandle(nearbyPlayer, ownerHandle, explosivePosition, CombatActionType.EXPLOSIVE_NEARBY);
+			
+			if (settings.CombatDebugMode)
 			{
-				float distance = vector.Distance(explosivePosition, nearbyPlayer.GetPosition());
-				if (distance <= radius)
-				{
-					// Register combat for both thrower and nearby player
-					GetCombatStateManager().RegisterCombatAction(thrower, nearbyPlayer, "EXPLOSIVE_NEAR_PLAYER", "");
-					GetCombatStateManager().RegisterCombatAction(nearbyPlayer, thrower, "EXPLOSIVE_NEARBY", "");
-					
-					if (settings.CombatDebugMode)
-					{
-						Print(string.Format("[SwarmObserver] Explosive proximity: %1 threw explosive near %2 (distance: %3m)",
-							thrower.GetIdentity().GetName(), 
-							nearbyPlayer.GetIdentity().GetName(),
-							distance));
-					}
-				}
+				Print(string.Format("[SwarmObserver] Explosive proximity: %1's explosive went off near %2 (distance: %3m)",
+					SwarmObserverIdentityTable.GetInstance().GetName(ownerHandle), 
+					SwarmObserverIdentityTable.GetInstance().GetName(nearbyHandle),
+					vector.Distance(explosivePosition, nearbyPlayer.GetPosition())));
 			}
 		}
 	}
 }
+#endif
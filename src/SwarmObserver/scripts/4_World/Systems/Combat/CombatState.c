@@ -1,27 +1,175 @@
+#ifndef SWARM_OBSERVER_NO_COMBAT
 // Combat state for a player
 class CombatState
 {
 	int m_CombatStartTime;
 	int m_LastCombatActionTime;
-	ref array<string> m_InvolvedPlayers;
+	ref set<int> m_InvolvedPlayers; // Identity handles
 	ref array<ref CombatAction> m_CombatActions;
 	vector m_LastPosition;
-	string m_LastDamageType;
+	int m_LastDamageType; // Ammo table handle
 	float m_LastHealthLevel;
 	
+	// Position trail ring (COMBAT_TRAIL_SIZE entries, preallocated)
+	// m_TrailXZ packs x and z, m_TrailYT packs y and seconds since combat start, 16 bits each
+	ref array<int> m_TrailXZ;
+	ref array<int> m_TrailYT;
+	int m_TrailHead;
+	int m_TrailCount;
+	
 	void CombatState()
 	{
-		m_InvolvedPlayers = new array<string>();
+		m_InvolvedPlayers = new set<int>();
 		m_CombatActions = new array<ref CombatAction>();
 		m_CombatStartTime = GetGame().GetTime();
 		m_LastCombatActionTime = m_CombatStartTime;
 		m_LastPosition = "0 0 0";
-		m_LastDamageType = "";
+		m_LastDamageType = 0;
 		m_LastHealthLevel = 1.0;
+		
+		m_TrailXZ = new array<int>();
+		m_TrailYT = new array<int>();
+		m_TrailXZ.Resize(SwarmObserverConstants.COMBAT_TRAIL_SIZE);
+		m_TrailYT.Resize(SwarmObserverConstants.COMBAT_TRAIL_SIZE);
+		m_TrailHead = 0;
+		m_TrailCount = 0;
+	}
+	
+	// Record a trail sample (skipped if the quantized position did not change since the last one)
+	void AddTrailSample(vector pos, int currentTime)
+	{
+		int xz = (QuantizeTrail(pos[0]) << 16) | QuantizeTrail(pos[2]);
+		
+		int size = SwarmObserverConstants.COMBAT_TRAIL_SIZE;
+		if (m_TrailCount > 0 && m_TrailXZ[(m_TrailHead + size - 1) % size] == xz)
+			return;
+		
+		int seconds = Math.Min((currentTime - m_CombatStartTime) / 1000, 0xFFFF);
+		m_TrailXZ[m_TrailHead] = xz;
+		m_TrailYT[m_TrailHead] = (QuantizeTrail(pos[1]) << 16) | seconds;
+		
+		m_TrailHead = (m_TrailHead + 1) % size;
+		if (m_TrailCount < size)
+			m_TrailCount++;
+	}
+	
+	// Export to the warm restart snapshot (timestamps become ages relative to currentTime)
+	void ExportWarmState(SwarmObserverWarmCombat data, int currentTime)
+	{
+		SwarmObserverIdentityTable identities = SwarmObserverIdentityTable.GetInstance();
+		SwarmObserverAmmoTable ammo = SwarmObserverAmmoTable.GetInstance();
+		
+		data.StartAgeMs = currentTime - m_CombatStartTime;
+		data.LastActionAgeMs = currentTime - m_LastCombatActionTime;
+		data.LastPosition = m_LastPosition;
+		data.LastDamageType = ammo.Resolve(m_LastDamageType);
+		data.LastHealthLevel = m_LastHealthLevel;
+		
+		foreach (int involved : m_InvolvedPlayers)
+		{
+			data.InvolvedSteamIDs.Insert(identities.GetSteamID(involved));
+			data.InvolvedNames.Insert(identities.GetName(involved));
+		}
+		
+		foreach (CombatAction action : m_CombatActions)
+		{
+			data.ActionTypes.Insert(action.m_ActionType);
+			data.ActionAgesMs.Insert(currentTime - action.m_Timestamp);
+			data.ActionOtherSteamIDs.Insert(identities.GetSteamID(action.m_OtherPlayer));
+			data.ActionOtherNames.Insert(identities.GetName(action.m_OtherPlayer));
+			data.ActionDamageTypes.Insert(ammo.Resolve(action.m_DamageType));
+			data.ActionDistances.Insert(action.m_Distance);
+			data.ActionPositions.Insert(action.m_Position);
+		}
+		
+		int size = SwarmObserverConstants.COMBAT_TRAIL_SIZE;
+		for (int i = m_TrailCount; i > 0; i--)
+		{
+			int index = (m_TrailHead + size - i) % size;
+			data.TrailXZ.Insert(m_TrailXZ[index]);
+			data.TrailYT.Insert(m_TrailYT[index]);
+		}
+	}
+	
+	// Import from the warm restart snapshot (ages are relative to currentTime, downtime already included)
+	void ImportWarmState(SwarmObserverWarmCombat data, int currentTime)
+	{
+		SwarmObserverIdentityTable identities = SwarmObserverIdentityTable.GetInstance();
+		SwarmObserverAmmoTable ammo = SwarmObserverAmmoTable.GetInstance();
+		
+		m_CombatStartTime = currentTime - data.StartAgeMs;
+		m_LastCombatActionTime = currentTime - data.LastActionAgeMs;
+		m_LastPosition = data.LastPosition;
+		m_LastDamageType = ammo.Intern(data.LastDamageType);
+		m_LastHealthLevel = data.LastHealthLevel;
+		
+		m_InvolvedPlayers.Clear();
+		for (int i = 0; i < data.InvolvedSteamIDs.Count(); i++)
+		{
+			m_InvolvedPlayers.Insert(identities.Register(data.InvolvedSteamIDs[i], data.InvolvedNames[i]));
+		}
+		
+		m_CombatActions.Clear();
+		for (int j = 0; j < data.ActionTypes.Count(); j++)
+		{
+			int otherPlayer = identities.Register(data.ActionOtherSteamIDs[j], data.ActionOtherNames[j]);
+			CombatAction action = new CombatAction(data.ActionTypes[j], otherPlayer, ammo.Intern(data.ActionDamageTypes[j]), data.ActionPositions[j], data.ActionDistances[j]);
+			action.m_Timestamp = currentTime - data.ActionAgesMs[j];
+			m_CombatActions.Insert(action);
+		}
+		
+		int size = SwarmObserverConstants.COMBAT_TRAIL_SIZE;
+		m_TrailCount = Math.Min(data.TrailXZ.Count(), size);
+		for (int k = 0; k < m_TrailCount; k++)
+		{
+			m_TrailXZ[k] = data.TrailXZ[data.TrailXZ.Count() - m_TrailCount + k];
+			m_TrailYT[k] = data.TrailYT[data.TrailYT.Count() - m_TrailCount + k];
+		}
+		m_TrailHead = m_TrailCount % size;
+	}
+	
+	// Get the most recent trail samples, oldest first, for the webhook
+	string GetTrailSummary(int maxPoints)
+	{
+		if (m_TrailCount == 0)
+			return "No positions recorded";
+		
+		int size = SwarmObserverConstants.COMBAT_TRAIL_SIZE;
+		int count = Math.Min(maxPoints, m_TrailCount);
+		string summary = "";
+		
+		for (int i = count; i > 0; i--)
+		{
+			int index = (m_TrailHead + size - i) % size;
+			int xz = m_TrailXZ[index];
+			int yt = m_TrailYT[index];
+			
+			if (summary != "")
+				summary += "\\n";
+			summary += string.Format("+%1s [%2, %3, %4]", yt & 0xFFFF, DequantizeTrail((xz >> 16) & 0xFFFF), DequantizeTrail((yt >> 16) & 0xFFFF), DequantizeTrail(xz & 0xFFFF));
+		}
+		
+		if (m_TrailCount > count)
+		{
+			summary = "... (" + (m_TrailCount - count).ToString() + " earlier)\\n" + summary;
+		}
+		
+		return summary;
+	}
+	
+	private static int QuantizeTrail(float value)
+	{
+		return Math.Clamp(Math.Round(value / SwarmObserverConstants.COMBAT_TRAIL_QUANTIZATION), 0, 0xFFFF);
+	}
+	
+	private static float DequantizeTrail(int value)
+	{
+		return value * SwarmObserverConstants.COMBAT_TRAIL_QUANTIZATION;
 	}
 	
 	// Update combat state with new action
-	void Update(PlayerBase player, PlayerBase otherPlayer, string actionType, string damageType)
+	// otherPlayer is an identity handle (0 when unknown), damageType an ammo table handle
+	void Update(PlayerBase player, int otherPlayer, vector otherPosition, int actionType, int damageType)
 	{
 		m_LastCombatActionTime = GetGame().GetTime();
 		m_LastPosition = player.GetPosition();
@@ -29,17 +177,18 @@ class CombatState
 		m_LastHealthLevel = player.GetHealth("", "Health");
 		
 		// Add the other player to involved players if not already present
-		if (otherPlayer && otherPlayer.GetIdentity())
+		float distance = 0;
+		if (otherPlayer != 0)
 		{
-			string otherPlayerID = otherPlayer.GetIdentity().GetPlainId();
-			if (m_InvolvedPlayers.Find(otherPlayerID) == -1)
+			if (m_InvolvedPlayers.Find(otherPlayer) == -1)
 			{
-				m_InvolvedPlayers.Insert(otherPlayerID);
+				m_InvolvedPlayers.Insert(otherPlayer);
 			}
+			distance = vector.Distance(m_LastPosition, otherPosition);
 		}
 		
 		// Add combat action (limit to MAX_COMBAT_ACTIONS_STORED)
-		ref CombatAction action = new CombatAction(actionType, otherPlayer, damageType, player.GetPosition());
+		CombatAction action = new CombatAction(actionType, otherPlayer, damageType, m_LastPosition, distance);
 		m_CombatActions.Insert(action);
 		
 		if (m_CombatActions.Count() > SwarmObserverConstants.MAX_COMBAT_ACTIONS_STORED)
@@ -48,17 +197,27 @@ class CombatState
 		}
 	}
 	
-	// Check if combat state has expired
-	bool IsExpired(int currentTime, int combatDuration)
+	// Estimated memory use (actions, involved handles and the preallocated trail)
+	int GetEstimatedBytes()
+	{
+		int bytes = 2 * SwarmObserverConstants.MEMORY_OBJECT_BYTES;
+		bytes += m_CombatActions.Count() * (SwarmObserverConstants.MEMORY_OBJECT_BYTES + 32);
+		bytes += m_InvolvedPlayers.Count() * 4;
+		bytes += 2 * SwarmObserverConstants.COMBAT_TRAIL_SIZE * 4;
+		return bytes;
+	}
+	
+	// Check if combat state has expired (duration in milliseconds)
+	bool IsExpired(int currentTime, int combatDurationMs)
 	{
-		return (currentTime - m_LastCombatActionTime) >= (combatDuration * 1000);
+		return (currentTime - m_LastCombatActionTime) >= combatDurationMs;
 	}
 	
-	// Get remaining time in seconds
-	int GetRemainingTime(int currentTime, int combatDuration)
+	// Get remaining time in seconds (duration in milliseconds)
+	int GetRemainingTime(int currentTime, int combatDurationMs)
 	{
 		int elapsed = currentTime - m_LastCombatActionTime;
-		int remaining = (combatDuration * 1000) - elapsed;
+		int remaining = combatDurationMs - elapsed;
 		return Math.Max(0, remaining / 1000);
 	}
 	
@@ -87,3 +246,4 @@ class CombatState
 		return summary;
 	}
 }
+#endif
@@ -1,3 +1,4 @@
+#ifndef SWARM_OBSERVER_NO_COMBAT
 // Combat state manager singleton
 class CombatStateManager
 {
@@ -5,10 +6,16 @@ class CombatStateManager
 	private ref map<PlayerBase, ref CombatState> m_CombatStates;
 	private bool m_CleanupTimerRunning;
 	
+	// Players in combat, walked round-robin by the trail sampler
+	private ref array<PlayerBase> m_CombatPlayers;
+	private int m_TrailCursor;
+	
 	void CombatStateManager()
 	{
 		m_CombatStates = new map<PlayerBase, ref CombatState>();
 		m_CleanupTimerRunning = false;
+		m_CombatPlayers = new array<PlayerBase>();
+		m_TrailCursor = 0;
 		
 		Print("[SwarmObserver] CombatStateManager initialized");
 	}
@@ -24,16 +31,32 @@ class CombatStateManager
 	}
 	
 	// Register a combat action for a player
-	void RegisterCombatAction(PlayerBase player, PlayerBase otherPlayer, string actionType, string damageType = "")
+	// actionType is a CombatActionType, damageType an ammo table handle (see SwarmObserverAmmoTable)
+	void RegisterCombatAction(PlayerBase player, PlayerBase otherPlayer, int actionType, int damageType = 0)
+	{
+		int otherHandle = 0;
+		vector otherPosition = vector.Zero;
+		if (otherPlayer)
+		{
+			otherHandle = otherPlayer.GetSwarmObserverHandle();
+			otherPosition = otherPlayer.GetPosition();
+		}
+		RegisterCombatActionByHandle(player, otherHandle, otherPosition, actionType, damageType);
+	}
+	
+	// Register a combat action against an identity handle (for sources whose player may no longer be connected)
+	void RegisterCombatActionByHandle(PlayerBase player, int otherHandle, vector otherPosition, int actionType, int damageType = 0)
 	{
 		if (!player || !GetGame().IsServer())
 			return;
 		
 		// Get config settings
-		SwarmObserverSettings settings = SwarmObserverSettings.GetInstance();
+		SwarmObserverSettingsSnapshot settings = SwarmObserverSettingsSnapshot.Get();
 		if (!settings.CombatLogoutEnabled)
 			return;
 		
+		int startTicks = TickCount(0);
+		
 		// Get or create combat state
 		CombatState state;
 		if (m_CombatStates.Contains(player))
@@ -42,27 +65,37 @@ class CombatStateManager
 		}
 		else
 		{
+			// At the cap, the least recently active state makes room
+			if (m_CombatStates.Count() >= settings.MaxCombatStates)
+				EvictLeastRecentState();
+			
 			state = new CombatState();
 			m_CombatStates.Set(player, state);
+			m_CombatPlayers.Insert(player);
+			
+			// Trail starts where the fight started
+			state.AddTrailSample(player.GetPosition(), state.m_CombatStartTime);
 		}
 		
 		// Update state
-		state.Update(player, otherPlayer, actionType, damageType);
+		state.Update(player, otherHandle, otherPosition, actionType, damageType);
 		
 		// Debug logging
 		if (settings.CombatDebugMode && player.GetIdentity())
 		{
 			string otherName = "Unknown";
-			if (otherPlayer && otherPlayer.GetIdentity())
+			if (otherHandle != 0)
 			{
-				otherName = otherPlayer.GetIdentity().GetName();
+				otherName = SwarmObserverIdentityTable.GetInstance().GetName(otherHandle);
 			}
 			Print(string.Format("[SwarmObserver] Combat action: %1 %2 %3", 
-				player.GetIdentity().GetName(), actionType, otherName));
+				player.GetIdentity().GetName(), typename.EnumToString(CombatActionType, actionType), otherName));
 		}
 		
 		// Ensure cleanup timer is running
 		StartCleanupTimer();
+		
+		SwarmObserverMetrics.Record(SwarmObserverMetric.COMBAT_ACTION, TickCount(startTicks));
 	}
 	
 	// Check if a player is in combat
@@ -72,10 +105,9 @@ class CombatStateManager
 			return false;
 		
 		CombatState state = m_CombatStates.Get(player);
-		SwarmObserverSettings settings = SwarmObserverSettings.GetInstance();
 		int currentTime = GetGame().GetTime();
 		
-		return !state.IsExpired(currentTime, settings.CombatDurationSeconds);
+		return !state.IsExpired(currentTime, SwarmObserverSettingsSnapshot.Get().CombatDurationMs);
 	}
 	
 	// Get combat state for a player
@@ -96,6 +128,7 @@ class CombatStateManager
 		if (m_CombatStates.Contains(player))
 		{
 			m_CombatStates.Remove(player);
+			m_CombatPlayers.RemoveItem(player);
 			
 			if (player.GetIdentity())
 			{
@@ -104,13 +137,44 @@ class CombatStateManager
 		}
 	}
 	
-	// Start the cleanup timer if not already running
+	// Drop the combat state with the oldest last action (cap reached)
+	private void EvictLeastRecentState()
+	{
+		PlayerBase oldestPlayer;
+		int oldestTime = int.MAX;
+		foreach (PlayerBase player, CombatState state : m_CombatStates)
+		{
+			if (state.m_LastCombatActionTime < oldestTime)
+			{
+				oldestTime = state.m_LastCombatActionTime;
+				oldestPlayer = player;
+			}
+		}
+		
+		Print("[SwarmObserver] Combat state cap reached (" + m_CombatStates.Count() + "), evicting least recently active state");
+		m_CombatStates.Remove(oldestPlayer);
+		m_CombatPlayers.RemoveItem(oldestPlayer);
+	}
+	
+	// Estimated memory use of the live combat states
+	int GetEstimatedBytes()
+	{
+		int bytes = 0;
+		foreach (PlayerBase player, CombatState state : m_CombatStates)
+		{
+			bytes += SwarmObserverConstants.MEMORY_OBJECT_BYTES + state.GetEstimatedBytes();
+		}
+		return bytes;
+	}
+	
+	// Start the cleanup and trail sampling timers if not already running
 	private void StartCleanupTimer()
 	{
 		if (!m_CleanupTimerRunning)
 		{
 			m_CleanupTimerRunning = true;
 			GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).CallLater(CleanExpiredStates, SwarmObserverConstants.COMBAT_CLEANUP_INTERVAL_MS, true);
+			GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).CallLater(SampleTrails, SwarmObserverConstants.COMBAT_TRAIL_SAMPLE_INTERVAL_MS, true);
 			Print("[SwarmObserver] Combat cleanup timer started");
 		}
 	}
@@ -121,14 +185,14 @@ class CombatStateManager
 		if (!GetGame().IsServer())
 			return;
 		
-		SwarmObserverSettings settings = SwarmObserverSettings.GetInstance();
+		SwarmObserverSettingsSnapshot settings = SwarmObserverSettingsSnapshot.Get();
 		int currentTime = GetGame().GetTime();
 		array<PlayerBase> expiredPlayers = new array<PlayerBase>();
 		
 		// Find expired states
 		foreach (PlayerBase player, CombatState state : m_CombatStates)
 		{
-			if (state.IsExpired(currentTime, settings.CombatDurationSeconds))
+			if (state.IsExpired(currentTime, settings.CombatDurationMs))
 			{
 				expiredPlayers.Insert(player);
 			}
@@ -145,20 +209,100 @@ class CombatStateManager
 				}
 			}
 			m_CombatStates.Remove(expiredPlayer);
+			m_CombatPlayers.RemoveItem(expiredPlayer);
 		}
 		
 		// Stop timer if no more active combat states
 		if (m_CombatStates.Count() == 0 && m_CleanupTimerRunning)
 		{
 			GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).Remove(CleanExpiredStates);
+			GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).Remove(SampleTrails);
 			m_CleanupTimerRunning = false;
 			Print("[SwarmObserver] Combat cleanup timer stopped (no active combat)");
 		}
 	}
 	
+	// Add live combat states to the warm restart snapshot
+	void ExportWarmState(SwarmObserverWarmState warmState)
+	{
+		int currentTime = GetGame().GetTime();
+		SwarmObserverSettingsSnapshot settings = SwarmObserverSettingsSnapshot.Get();
+		
+		foreach (PlayerBase player, CombatState state : m_CombatStates)
+		{
+			if (!player || state.IsExpired(currentTime, settings.CombatDurationMs))
+				continue;
+			
+			SwarmObserverWarmCombat data = new SwarmObserverWarmCombat();
+			data.SteamID = SwarmObserverIdentityTable.GetInstance().GetSteamID(player.GetSwarmObserverHandle());
+			if (data.SteamID == "")
+				continue;
+			
+			state.ExportWarmState(data, currentTime);
+			warmState.CombatStates.Insert(data);
+		}
+	}
+	
+	// Reattach a combat state saved before a restart once its player is back (called on ClientReady)
+	void RestoreWarmCombatState(PlayerBase player, string steamID)
+	{
+		SwarmObserverWarmState warmState = SwarmObserverWarmState.GetRestored();
+		if (!player || !warmState)
+			return;
+		
+		SwarmObserverWarmCombat data = warmState.TakeCombatState(steamID);
+		if (!data)
+			return;
+		
+		int currentTime = GetGame().GetTime();
+		CombatState state = new CombatState();
+		state.ImportWarmState(data, currentTime);
+		if (state.IsExpired(currentTime, SwarmObserverSettingsSnapshot.Get().CombatDurationMs))
+			return;
+		
+		if (!m_CombatStates.Contains(player))
+			m_CombatPlayers.Insert(player);
+		m_CombatStates.Set(player, state);
+		StartCleanupTimer();
+		
+		Print("[SwarmObserver] Combat state restored after restart for " + steamID);
+	}
+	
+	// Sample trail positions (called by timer)
+	// Only COMBAT_TRAIL_SAMPLES_PER_TICK players are sampled per tick, so the cost stays flat however many are in combat
+	void SampleTrails()
+	{
+		int count = m_CombatPlayers.Count();
+		if (count == 0)
+			return;
+		
+		int currentTime = GetGame().GetTime();
+		int budget = Math.Min(SwarmObserverConstants.COMBAT_TRAIL_SAMPLES_PER_TICK, count);
+		
+		for (int i = 0; i < budget; i++)
+		{
+			if (m_TrailCursor >= count)
+				m_TrailCursor = 0;
+			
+			PlayerBase player = m_CombatPlayers[m_TrailCursor];
+			m_TrailCursor++;
+			
+			CombatState state;
+			if (player && m_CombatStates.Find(player, state))
+				state.AddTrailSample(player.GetPosition(), currentTime);
+		}
+	}
+	
+	// Live combat states by player (read only, for admin tools)
+	map<PlayerBase, ref CombatState> GetCombatStates()
+	{
+		return m_CombatStates;
+	}
+	
 	// Get count of active combat states (for debugging)
 	int GetActiveCombatCount()
 	{
 		return m_CombatStates.Count();
 	}
 }
+#endif
@@ -1,34 +1,33 @@
+#ifndef SWARM_OBSERVER_NO_COMBAT
 // Combat logout webhook sender
 class CombatWebhook
 {
 	// Send combat logout notification to Discord webhook
-	static void SendCombatLogoutNotification(string steamID, string playerName, vector pos, CombatState state)
+	// disconnectTime is the game time of the (last) logout, logoutCount the logouts collapsed into this alert
+	static void SendCombatLogoutNotification(string steamID, string playerName, vector pos, CombatState state, int disconnectTime, int logoutCount)
 	{
 		if (!state || !GetGame().IsServer())
 			return;
 		
-		SwarmObserverSettings settings = SwarmObserverSettings.GetInstance();
+		SwarmObserverSettingsSnapshot settings = SwarmObserverSettingsSnapshot.Get();
 		
-		// Check if webhook URL is configured
-		string webhookURL = settings.CombatWebhookURL;
-		if (webhookURL == "")
-		{
-			webhookURL = settings.WebhookURL;
-		}
-		
-		if (webhookURL == "" || webhookURL.Contains("YOUR_WEBHOOK"))
+		// Check if webhook URL is configured (combat webhook falls back to the main one)
+		SwarmObserverEndpoint endpoint = settings.CombatWebhook;
+		if (!endpoint.Valid)
 		{
 			Print("[SwarmObserver] Combat logout webhook URL not configured, skipping notification");
 			return;
 		}
 		string timestamp = GetCurrentTimestampISO();
-		int remainingTime = state.GetRemainingTime(GetGame().GetTime(), settings.CombatDurationSeconds);
+		int remainingTime = state.GetRemainingTime(disconnectTime, settings.CombatDurationMs);
 		
-		// Build list of involved players
+		// Build list of involved players (resolve identity handles to Steam IDs)
+		SwarmObserverIdentityTable identities = SwarmObserverIdentityTable.GetInstance();
 		string involvedPlayers = "";
 		for (int i = 0; i < state.m_InvolvedPlayers.Count(); i++)
 		{
-			involvedPlayers += "[" + state.m_InvolvedPlayers[i] + "](https://steamcommunity.com/profiles/" + state.m_InvolvedPlayers[i] + ")";
+			string involvedID = identities.GetSteamID(state.m_InvolvedPlayers.Get(i));
+			involvedPlayers += "[" + involvedID + "](https://steamcommunity.com/profiles/" + involvedID + ")";
 			if (i < state.m_InvolvedPlayers.Count() - 1)
 				involvedPlayers += ", ";
 		}
@@ -39,6 +38,9 @@ class CombatWebhook
 		string actionSummary = state.GetActionSummary();
 		actionSummary = EscapeJSON(actionSummary);
 		
+		// Build position trail (escaped for JSON)
+		string trail = EscapeJSON(state.GetTrailSummary(SwarmObserverConstants.COMBAT_TRAIL_WEBHOOK_POINTS));
+		
 		// Build Steam profile URL
 		string steamProfileURL = "https://steamcommunity.com/profiles/" + steamID;
 		
@@ -57,9 +59,11 @@ class CombatWebhook
 		jsonPayload += "        {\"name\": \"Position\", \"value\": \"[" + pos[0].ToString() + ", " + pos[1].ToString() + ", " + pos[2].ToString() + "]\", \"inline\": false},\n";
 		jsonPayload += "        {\"name\": \"Health\", \"value\": \"" + (state.m_LastHealthLevel).ToString() + "%\", \"inline\": true},\n";
 		jsonPayload += "        {\"name\": \"Time Remaining\", \"value\": \"" + remainingTime.ToString() + "s\", \"inline\": true},\n";
-		jsonPayload += "        {\"name\": \"Last Damage Type\", \"value\": \"" + EscapeJSON(state.m_LastDamageType) + "\", \"inline\": false},\n";
+		jsonPayload += "        {\"name\": \"Combat Logouts\", \"value\": \"" + logoutCount.ToString() + "\", \"inline\": true},\n";
+		jsonPayload += "        {\"name\": \"Last Damage Type\", \"value\": \"" + EscapeJSON(SwarmObserverAmmoTable.GetInstance().Resolve(state.m_LastDamageType)) + "\", \"inline\": false},\n";
 		jsonPayload += "        {\"name\": \"Involved Players\", \"value\": \"" + EscapeJSON(involvedPlayers) + "\", \"inline\": false},\n";
-		jsonPayload += "        {\"name\": \"Recent Actions\", \"value\": \"" + actionSummary + "\", \"inline\": false}\n";
+		jsonPayload += "        {\"name\": \"Recent Actions\", \"value\": \"" + actionSummary + "\", \"inline\": false},\n";
+		jsonPayload += "        {\"name\": \"Position Trail\", \"value\": \"" + trail + "\", \"inline\": false}\n";
 		jsonPayload += "      ],\n";
 		jsonPayload += "      \"timestamp\": \"" + timestamp + "\",\n";
 		jsonPayload += "      \"footer\": {\n";
@@ -71,39 +75,12 @@ class CombatWebhook
 		
 		Print("[SwarmObserver] Sending combat logout webhook for " + playerName);
 		
-		// Parse webhook URL to extract host and path
-		string host = "";
-		string path = "";
-		
-		// Remove https:// or http://
-		if (webhookURL.IndexOf("https://") == 0)
-		{
-			webhookURL = webhookURL.Substring(8, webhookURL.Length() - 8);
-		}
-		else if (webhookURL.IndexOf("http://") == 0)
-		{
-			webhookURL = webhookURL.Substring(7, webhookURL.Length() - 7);
-		}
-		
-		// Split host and path
-		int slashPos = webhookURL.IndexOf("/");
-		if (slashPos > 0)
-		{
-			host = webhookURL.Substring(0, slashPos);
-			path = webhookURL.Substring(slashPos, webhookURL.Length() - slashPos);
-		}
-		else
-		{
-			host = webhookURL;
-			path = "/";
-		}
-		
-		// Send webhook via RestApi
-		RestContext ctx = GetRestApi().GetRestContext("https://" + host);
+		// Send webhook via RestApi (endpoint host and path are parsed once in the settings snapshot)
+		RestContext ctx = GetRestApi().GetRestContext("https://" + endpoint.Host);
 		if (ctx)
 		{
 			ctx.SetHeader("application/json");
-			ctx.POST(new CombatWebhookCallback(playerName), path, jsonPayload);
+			ctx.POST(new CombatWebhookCallback(playerName), endpoint.Path, jsonPayload);
 		}
 		else
 		{
@@ -153,3 +130,4 @@ class CombatWebhook
 		return str;
 	}
 }
+#endif
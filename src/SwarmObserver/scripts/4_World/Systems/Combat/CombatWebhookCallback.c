@@ -1,3 +1,4 @@
+#ifndef SWARM_OBSERVER_NO_COMBAT
 // Webhook callback for combat logout notifications
 class CombatWebhookCallback extends RestCallback
 {
@@ -23,3 +24,4 @@ class CombatWebhookCallback extends RestCallback
 		Print("[SwarmObserver] Combat logout webhook timeout for player: " + m_PlayerName);
 	}
 }
+#endif
@@ -1,3 +1,4 @@
+#ifndef SWARM_OBSERVER_NO_ZONES
 modded class InGameMenu
 {
 	// Override the actual exit button click handler
@@ -27,3 +28,4 @@ modded class InGameMenu
 		super.OnClick_Exit();
 	}
 }
+#endif
@@ -6,6 +6,42 @@ modded class MissionServer
 		
 		// Initialize SwarmObserver module (creates directories, loads config, loads history)
 		SwarmObserverModule.Initialize();
+		
+		#ifndef SWARM_OBSERVER_NO_COMBAT
+		// Pending combat logout alerts from before a restart (combat states reattach on ClientReady)
+		CombatLogoutGraceManager.RestoreWarmState(SwarmObserverWarmState.GetRestored());
+		
+		// Synthetic load benchmark (only with the -swarmObserverBenchmark launch parameter)
+		SwarmObserverBenchmark.Start();
+		#endif
+	}
+	
+	override void OnUpdate(float timeslice)
+	{
+		super.OnUpdate(timeslice);
+		
+		#ifndef SWARM_OBSERVER_NO_COMBAT
+		SwarmObserverBenchmark.OnFrame(timeslice);
+		#endif
+	}
+	
+	override void OnMissionFinish()
+	{
+		// Snapshot live state so a restart does not wipe pending deadlines
+		SwarmObserverWarmState warmState = new SwarmObserverWarmState();
+		
+		#ifndef SWARM_OBSERVER_NO_ZONES
+		SwarmObserverGracePeriodManager.ExportWarmState(warmState);
+		#endif
+		
+		#ifndef SWARM_OBSERVER_NO_COMBAT
+		GetCombatStateManager().ExportWarmState(warmState);
+		CombatLogoutGraceManager.ExportWarmState(warmState);
+		#endif
+		
+		warmState.Save();
+		
+		super.OnMissionFinish();
 	}
 	
 	// Called when player clicks disconnect - store data for when they actually disconnect
@@ -18,32 +54,49 @@ modded class MissionServer
 		if (!player || !identity)
 			return;
 		
-		string steamID = identity.GetPlainId();
-		string uid = identity.GetId();
-		string playerName = identity.GetName();
+		SwarmObserverStoreLogoutData(identity.GetId(), identity.GetPlainId(), identity.GetName(), player);
+	}
+	
+	// Disconnect bookkeeping (also driven by the benchmark for its dummy players)
+	void SwarmObserverStoreLogoutData(string uid, string steamID, string playerName, PlayerBase player)
+	{
+		int startTicks = TickCount(0);
 		vector playerPos = player.GetPosition();
 		
 		// Check if player is in a restricted area
-		SwarmObserverRestrictedArea area = SwarmObserverSettings.GetRestrictedAreaAtPosition(playerPos);
 		string areaName = "";
+		#ifndef SWARM_OBSERVER_NO_ZONES
+		SwarmObserverRestrictedArea area = SwarmObserverSettings.GetRestrictedAreaAtPosition(playerPos);
 		if (area)
 			areaName = area.Name;
+		#endif
+		
+		// Store data keyed by Steam ID for retrieval in PlayerDisconnected
+		SwarmObserverLogoutData data = SwarmObserverLogoutManager.StoreLogoutData(uid, steamID, playerName, playerPos, areaName);
 		
+		#ifndef SWARM_OBSERVER_NO_COMBAT
 		// Check if player is in combat
-		bool inCombat = GetCombatStateManager().IsInCombat(player);
-		CombatState combatState = null;
-		if (inCombat)
+		if (GetCombatStateManager().IsInCombat(player))
 		{
-			combatState = GetCombatStateManager().GetCombatState(player);
+			data.WasInCombat = true;
+			data.CombatStateData = GetCombatStateManager().GetCombatState(player);
 			Print("[SwarmObserver] Storing combat logout data for " + playerName + " (" + steamID + ")");
 		}
+		#endif
 		
-		// Store data keyed by Steam ID for retrieval in PlayerDisconnected
-		SwarmObserverLogoutManager.StoreLogoutData(uid, steamID, playerName, playerPos, areaName, inCombat, combatState);
+		SwarmObserverMetrics.Record(SwarmObserverMetric.DISCONNECT, TickCount(startTicks));
 	}
 	
 	// Called when player ACTUALLY disconnects (after logout timer)
 	override void PlayerDisconnected(PlayerBase player, PlayerIdentity identity, string uid)
+	{
+		SwarmObserverHandleDisconnect(player, uid);
+		
+		super.PlayerDisconnected(player, identity, uid);
+	}
+	
+	// Start grace periods and combat logouts from the stored data (also driven by the benchmark)
+	void SwarmObserverHandleDisconnect(PlayerBase player, string uid)
 	{
 		Print("[SwarmObserver] PlayerDisconnected called for uid: " + uid);
 		
@@ -51,35 +104,39 @@ modded class MissionServer
 		SwarmObserverLogoutData data = SwarmObserverLogoutManager.GetLogoutData(uid);
 		
 		if (data)
-			Print("[SwarmObserver] Retrieved logout data for " + data.PlayerName + ", combat=" + data.WasInCombat.ToString());
+			Print("[SwarmObserver] Retrieved logout data for " + data.PlayerName);
 		else
 			Print("[SwarmObserver] No logout data found for uid: " + uid);
 		
 		if (data)
 		{
+			#ifndef SWARM_OBSERVER_NO_ZONES
 			// Handle restricted area violation
 			if (data.RestrictedAreaName != "")
 			{
 				Print("[SwarmObserver] Player " + data.PlayerName + " disconnected from restricted area: " + data.RestrictedAreaName);
 				SwarmObserverGracePeriodManager.StartGracePeriod(data.SteamID, data.PlayerName, data.RestrictedAreaName);
 			}
+			#endif
 			
-			// Handle combat logout
+			#ifndef SWARM_OBSERVER_NO_COMBAT
+			// Handle combat logout (alert deferred until the grace window passes without a reconnect)
 			if (data.WasInCombat && data.CombatStateData)
 			{
 				Print("[SwarmObserver] Player " + data.PlayerName + " disconnected while in combat");
-				CombatWebhook.SendCombatLogoutNotification(data.SteamID, data.PlayerName, data.Position, data.CombatStateData);
+				CombatLogoutGraceManager.StartCombatLogout(data.SteamID, data.PlayerName, data.Position, data.CombatStateData);
 			}
+			#endif
 			
 			// Clean up stored data
 			SwarmObserverLogoutManager.RemoveLogoutData(uid);
 		}
 		
+		#ifndef SWARM_OBSERVER_NO_COMBAT
 		// Clean up combat state
 		if (player)
 			GetCombatStateManager().RemoveCombatState(player);
-		
-		super.PlayerDisconnected(player, identity, uid);
+		#endif
 	}
 	
 	override void OnEvent(EventType eventTypeId, Param params)
@@ -100,6 +157,15 @@ modded class MissionServer
 					string steamID = identity.GetPlainId();
 					string playerName = identity.GetName();
 					
+					#ifndef SWARM_OBSERVER_NO_COMBAT
+					// Reconnected before a pending combat logout alert went out
+					CombatLogoutGraceManager.CancelCombatLogout(steamID);
+					
+					// Still in combat when the server restarted
+					GetCombatStateManager().RestoreWarmCombatState(player, steamID);
+					#endif
+					
+					#ifndef SWARM_OBSERVER_NO_ZONES
 					// Check if player has active grace period (reconnected in time)
 					if (SwarmObserverGracePeriodManager.HasActiveGracePeriod(steamID))
 					{
@@ -124,8 +190,9 @@ modded class MissionServer
 								true, identity);
 						}
 					}
+					#endif
 				}
 			}
 		}
 	}
-}
+}
\ No newline at end of file
@@ -0,0 +1,393 @@
+#ifndef SWARM_OBSERVER_NO_COMBAT
+// Benchmark phases
+enum SwarmObserverBenchmarkPhase
+{
+	SPAWNING,
+	WARMUP,
+	RUNNING,
+	DONE
+}
+
+// Synthetic load benchmark for the combat pipeline
+// Meant for a local server without clients: spawns dummy players in clusters, then drives hits, full-auto fire,
+// grenades and logouts through the same code the engine hooks call. Hook timings come from SwarmObserverMetrics,
+// store sizes from SwarmObserverMemoryReport, and the report is written to $profile:SwarmObserver\benchmark_<time>.txt.
+class SwarmObserverBenchmark
+{
+	private static ref SwarmObserverBenchmark s_Instance;
+	
+	protected SwarmObserverBenchmarkSettings m_Settings;
+	protected ref array<PlayerBase> m_Players;
+	protected int m_Phase;
+	protected int m_PhaseStartTime;
+	
+	// Fractional events carried over to the next tick
+	protected float m_HitCredit;
+	protected float m_GrenadeCredit;
+	protected float m_LogoutCredit;
+	
+	// Full-auto shooters (player indexes) and the rounds left in their bursts
+	protected ref array<int> m_Shooters;
+	protected ref array<int> m_RoundsLeft;
+	
+	// Events driven during the measured phase
+	protected int m_Hits;
+	protected int m_Rounds;
+	protected int m_Grenades;
+	protected int m_Logouts;
+	
+	protected ref array<float> m_FrameTimes; // Milliseconds, measured phase only
+	protected ref array<string> m_StoresBefore;
+	
+	void SwarmObserverBenchmark()
+	{
+		m_Settings = SwarmObserverBenchmarkSettings.GetInstance();
+		m_Players = new array<PlayerBase>;
+		m_Shooters = new array<int>;
+		m_RoundsLeft = new array<int>;
+		m_FrameTimes = new array<float>;
+		m_StoresBefore = new array<string>;
+		m_Phase = SwarmObserverBenchmarkPhase.SPAWNING;
+	}
+	
+	// Start the benchmark if benchmark mode is on (called from MissionServer.OnInit)
+	static void Start()
+	{
+		if (!SwarmObserverBenchmarkSettings.IsLoadBenchmark() || s_Instance)
+			return;
+		
+		s_Instance = new SwarmObserverBenchmark();
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(s_Instance.Tick, SwarmObserverConstants.BENCHMARK_TICK_MS, true);
+		Print("[SwarmObserver] Benchmark started, spawning " + s_Instance.m_Settings.PlayerCount + " players");
+	}
+	
+	// Record the frame time (called from MissionServer.OnUpdate)
+	static void OnFrame(float timeslice)
+	{
+		if (s_Instance && s_Instance.m_Phase == SwarmObserverBenchmarkPhase.RUNNING)
+			s_Instance.m_FrameTimes.Insert(timeslice * 1000);
+	}
+	
+	// Advance the current phase (called by timer)
+	void Tick()
+	{
+		int elapsed = GetGame().GetTime() - m_PhaseStartTime;
+		
+		switch (m_Phase)
+		{
+			case SwarmObserverBenchmarkPhase.SPAWNING:
+				if (!SpawnBatch())
+				{
+					Finish();
+				}
+				else if (m_Players.Count() >= m_Settings.PlayerCount)
+				{
+					Print("[SwarmObserver] Benchmark players spawned, warming up for " + m_Settings.WarmupSeconds + "s");
+					SetPhase(SwarmObserverBenchmarkPhase.WARMUP);
+				}
+				break;
+			
+			case SwarmObserverBenchmarkPhase.WARMUP:
+				DriveLoad();
+				if (elapsed >= m_Settings.WarmupSeconds * 1000)
+					BeginMeasurement();
+				break;
+			
+			case SwarmObserverBenchmarkPhase.RUNNING:
+				DriveLoad();
+				if (elapsed >= m_Settings.DurationSeconds * 1000)
+					Finish();
+				break;
+		}
+	}
+	
+	protected void SetPhase(int phase)
+	{
+		m_Phase = phase;
+		m_PhaseStartTime = GetGame().GetTime();
+	}
+	
+	// Spawn the next batch of dummies (false if the player type cannot be created)
+	protected bool SpawnBatch()
+	{
+		int clusterCount = (m_Settings.PlayerCount + m_Settings.ClusterSize - 1) / m_Settings.ClusterSize;
+		int clustersPerRow = Math.Max(1, Math.Ceil(Math.Sqrt(clusterCount)));
+		
+		for (int i = 0; i < SwarmObserverConstants.BENCHMARK_SPAWN_BATCH && m_Players.Count() < m_Settings.PlayerCount; i++)
+		{
+			int index = m_Players.Count();
+			int cluster = index / m_Settings.ClusterSize;
+			
+			vector pos = m_Settings.Origin;
+			pos[0] = pos[0] + (cluster % clustersPerRow) * m_Settings.ClusterSpacing + Math.RandomFloatInclusive(-m_Settings.ClusterRadius, m_Settings.ClusterRadius);
+			pos[2] = pos[2] + (cluster / clustersPerRow) * m_Settings.ClusterSpacing + Math.RandomFloatInclusive(-m_Settings.ClusterRadius, m_Settings.ClusterRadius);
+			pos[1] = GetGame().SurfaceY(pos[0], pos[2]);
+			
+			PlayerBase player = PlayerBase.Cast(GetGame().CreatePlayer(null, m_Settings.PlayerType, pos, 0, "NONE"));
+			if (!player)
+			{
+				Print("[SwarmObserver] Benchmark aborted: could not create player type " + m_Settings.PlayerType);
+				return false;
+			}
+			
+			player.SetSwarmObserverSyntheticIdentity(GetSyntheticID(index), "Benchmark " + index);
+			CombatPlayerIndex.GetInstance().AddSyntheticPlayer(player);
+			m_Players.Insert(player);
+		}
+		return true;
+	}
+	
+	// Warmup is over: reset the hook timings and start recording
+	protected void BeginMeasurement()
+	{
+		SwarmObserverMetrics.Reset();
+		CollectStores(m_StoresBefore);
+		
+		m_Hits = 0;
+		m_Rounds = 0;
+		m_Grenades = 0;
+		m_Logouts = 0;
+		
+		Print("[SwarmObserver] Benchmark measuring for " + m_Settings.DurationSeconds + "s");
+		SetPhase(SwarmObserverBenchmarkPhase.RUNNING);
+	}
+	
+	// One tick worth of synthetic events
+	protected void DriveLoad()
+	{
+		float tickSeconds = SwarmObserverConstants.BENCHMARK_TICK_MS / 1000.0;
+		
+		m_HitCredit += m_Settings.HitsPerSecond * tickSeconds;
+		while (m_HitCredit >= 1)
+		{
+			m_HitCredit -= 1;
+			DriveHit();
+		}
+		
+		// Every shooter fires one round per tick until its burst runs out, then another player takes over
+		while (m_Shooters.Count() < m_Settings.FullAutoShooters)
+		{
+			m_Shooters.Insert(0);
+			m_RoundsLeft.Insert(0);
+		}
+		for (int slot = 0; slot < m_Settings.FullAutoShooters; slot++)
+		{
+			DriveRound(slot);
+		}
+		
+		m_GrenadeCredit += m_Settings.GrenadesPerSecond * tickSeconds;
+		while (m_GrenadeCredit >= 1)
+		{
+			m_GrenadeCredit -= 1;
+			DriveGrenade();
+		}
+		
+		m_LogoutCredit += m_Settings.LogoutsPerSecond * tickSeconds;
+		while (m_LogoutCredit >= 1)
+		{
+			m_LogoutCredit -= 1;
+			DriveLogout();
+		}
+	}
+	
+	// Same path as PlayerBase.EEHitBy
+	protected void DriveHit()
+	{
+		int attacker = Math.RandomInt(0, m_Players.Count());
+		int victim = GetClusterMate(attacker);
+		
+		m_Players[victim].OnSwarmObserverHit(m_Players[attacker], m_Settings.AmmoType);
+		m_Hits++;
+	}
+	
+	// Same path as Weapon_Base.EEFired, aimed at a player of the shooter's cluster
+	protected void DriveRound(int slot)
+	{
+		if (m_RoundsLeft[slot] <= 0)
+		{
+			m_Shooters[slot] = Math.RandomInt(0, m_Players.Count());
+			m_RoundsLeft[slot] = m_Settings.BurstLength;
+		}
+		
+		PlayerBase shooter = m_Players[m_Shooters[slot]];
+		PlayerBase target = m_Players[GetClusterMate(m_Shooters[slot])];
+		m_RoundsLeft[slot] = m_RoundsLeft[slot] - 1;
+		
+		vector muzzlePos = shooter.GetPosition() + "0 1.5 0";
+		vector muzzleDir = target.GetPosition() + "0 1.5 0" - muzzlePos;
+		if (muzzleDir.LengthSq() < 0.0001)
+			muzzleDir = shooter.GetDirection();
+		muzzleDir.Normalize();
+		
+		SwarmObserverSettingsSnapshot settings = SwarmObserverSettingsSnapshot.Get();
+		float radius = settings.GetShotRadius(m_Settings.AmmoType, "");
+		float range = settings.GetShotTrajectoryRange(m_Settings.AmmoType);
+		
+		int startTicks = TickCount(0);
+		CombatProximityDetector.CheckShotProximity(shooter, shooter.GetPosition(), radius, range, muzzlePos, muzzleDir);
+		SwarmObserverMetrics.Record(SwarmObserverMetric.SHOT, TickCount(startTicks));
+		m_Rounds++;
+	}
+	
+	// Same path as ExplosivesBase.OnSwarmObserverExplode, landing next to a player of the thrower's cluster
+	protected void DriveGrenade()
+	{
+		int thrower = Math.RandomInt(0, m_Players.Count());
+		vector explosionPos = m_Players[GetClusterMate(thrower)].GetPosition() + "2 0 2";
+		
+		int startTicks = TickCount(0);
+		float radius = SwarmObserverSettingsSnapshot.Get().ExplosiveProximityRadius;
+		CombatProximityDetector.CheckExplosiveProximity(m_Players[thrower].GetSwarmObserverHandle(), explosionPos, radius);
+		SwarmObserverMetrics.Record(SwarmObserverMetric.EXPLOSION, TickCount(startTicks));
+		m_Grenades++;
+	}
+	
+	// Both halves of a disconnect; the dummy stays in the world and is back in the fight on the next tick
+	protected void DriveLogout()
+	{
+		MissionServer mission = MissionServer.Cast(GetGame().GetMission());
+		if (!mission)
+			return;
+		
+		int index = Math.RandomInt(0, m_Players.Count());
+		string syntheticID = GetSyntheticID(index);
+		
+		mission.SwarmObserverStoreLogoutData(syntheticID, syntheticID, "Benchmark " + index, m_Players[index]);
+		mission.SwarmObserverHandleDisconnect(m_Players[index], syntheticID);
+		m_Logouts++;
+	}
+	
+	// Another player of the same cluster
+	protected int GetClusterMate(int index)
+	{
+		int first = (index / m_Settings.ClusterSize) * m_Settings.ClusterSize;
+		int size = Math.Min(m_Settings.ClusterSize, m_Players.Count() - first);
+		if (size < 2)
+			return (index + 1) % m_Players.Count();
+		
+		int mate = first + Math.RandomInt(0, size - 1);
+		if (mate >= index)
+			mate++;
+		return mate;
+	}
+	
+	protected static string GetSyntheticID(int index)
+	{
+		return "benchmark" + index;
+	}
+	
+	protected void CollectStores(array<string> lines)
+	{
+		SwarmObserverMemoryReport report = new SwarmObserverMemoryReport();
+		report.Collect();
+		
+		lines.Copy(report.GetLines());
+		lines.Insert("Total: ~" + (report.GetTotalBytes() / 1024) + " KB");
+	}
+	
+	// Write the report, remove the dummies and optionally stop the server
+	protected void Finish()
+	{
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(Tick);
+		
+		if (m_Phase == SwarmObserverBenchmarkPhase.RUNNING)
+			WriteReport();
+		
+		m_Phase = SwarmObserverBenchmarkPhase.DONE;
+		
+		CombatPlayerIndex.GetInstance().ClearSyntheticPlayers();
+		for (int i = 0; i < m_Players.Count(); i++)
+		{
+			// Pending grace periods and combat logout alerts would otherwise fire once webhooks are back
+			string syntheticID = GetSyntheticID(i);
+			#ifndef SWARM_OBSERVER_NO_ZONES
+			SwarmObserverGracePeriodManager.CancelGracePeriod(syntheticID);
+			#endif
+			CombatLogoutGraceManager.CancelCombatLogout(syntheticID);
+			
+			PlayerBase player = m_Players[i];
+			if (!player)
+				continue;
+			
+			GetCombatStateManager().RemoveCombatState(player);
+			GetGame().ObjectDelete(player);
+		}
+		m_Players.Clear();
+		m_Shooters.Clear();
+		
+		Print("[SwarmObserver] Benchmark finished");
+		SwarmObserverBenchmarkSettings.Finished();
+	}
+	
+	protected void WriteReport()
+	{
+		float seconds = (GetGame().GetTime() - m_PhaseStartTime) / 1000.0;
+		
+		string stamp = SwarmObserverBenchmarkSettings.GetReportStamp();
+		string path = SwarmObserverConstants.FILE_BENCHMARK_REPORT_PREFIX + stamp + ".txt";
+		
+		FileHandle file = OpenFile(path, FileMode.WRITE);
+		if (file == 0)
+		{
+			Print("[SwarmObserver] Failed to write benchmark report: " + path);
+			return;
+		}
+		
+		FPrintln(file, "SwarmObserver benchmark " + stamp);
+		FPrintln(file, string.Format("Players: %1 in clusters of %2 (%3m apart, %4m radius)", m_Players.Count(), m_Settings.ClusterSize, m_Settings.ClusterSpacing, m_Settings.ClusterRadius));
+		FPrintln(file, string.Format("Measured: %1s after %2s warmup", seconds, m_Settings.WarmupSeconds));
+		FPrintln(file, string.Format("Load: %1 hits/s, %2 full-auto shooters (%3 round bursts), %4 grenades/s, %5 logouts/s", m_Settings.HitsPerSecond, m_Settings.FullAutoShooters, m_Settings.BurstLength, m_Settings.GrenadesPerSecond, m_Settings.LogoutsPerSecond));
+		FPrintln(file, string.Format("Driven: %1 hits, %2 rounds, %3 grenades, %4 logouts", m_Hits, m_Rounds, m_Grenades, m_Logouts));
+		
+		FPrintln(file, "");
+		FPrintln(file, "Hook timings (ms):");
+		for (int metric = 0; metric < SwarmObserverMetric.COUNT; metric++)
+		{
+			int calls = SwarmObserverMetrics.GetCalls(metric);
+			FPrintln(file, string.Format("  %1: %2 calls (%3/s), avg %4, max %5, total %6", SwarmObserverMetrics.GetName(metric), calls, calls / seconds, SwarmObserverMetrics.GetAverageMs(metric), SwarmObserverMetrics.GetMaxMs(metric), SwarmObserverMetrics.GetTotalMs(metric)));
+		}
+		
+		FPrintln(file, "");
+		FPrintln(file, "Frame times (ms):");
+		int frames = m_FrameTimes.Count();
+		if (frames > 0)
+		{
+			float totalMs = 0;
+			foreach (float frameMs : m_FrameTimes)
+			{
+				totalMs += frameMs;
+			}
+			
+			m_FrameTimes.Sort();
+			FPrintln(file, string.Format("  %1 frames (%2 fps), avg %3, p50 %4, p95 %5, p99 %6, max %7", frames, frames / seconds, totalMs / frames, GetPercentile(0.5), GetPercentile(0.95), GetPercentile(0.99), m_FrameTimes[frames - 1]));
+		}
+		
+		array<string> storesAfter = new array<string>;
+		CollectStores(storesAfter);
+		
+		FPrintln(file, "");
+		FPrintln(file, "Stores when measuring started:");
+		foreach (string before : m_StoresBefore)
+		{
+			FPrintln(file, "  " + before);
+		}
+		
+		FPrintln(file, "");
+		FPrintln(file, "Stores at the end:");
+		foreach (string after : storesAfter)
+		{
+			FPrintln(file, "  " + after);
+		}
+		
+		CloseFile(file);
+		Print("[SwarmObserver] Benchmark report written to " + path);
+	}
+	
+	// Frame time percentile (m_FrameTimes must be sorted)
+	protected float GetPercentile(float fraction)
+	{
+		int index = Math.Min(m_FrameTimes.Count() - 1, Math.Floor(m_FrameTimes.Count() * fraction));
+		return m_FrameTimes[index];
+	}
+}
+#endif
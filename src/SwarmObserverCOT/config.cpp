@@ -0,0 +1,49 @@
+// SwarmObserverCOT adds Community Online Tools admin panels on top of SwarmObserver
+// The server answers the panels over RPC, so admins never have to open the SwarmObserver profile files
+// Needs SwarmObserver, CF and COT
+
+class CfgPatches
+{
+    class SwarmObserverCOT
+    {
+        units[] = {};
+        weapons[] = {};
+        requiredVersion = 0.1;
+        requiredAddons[] = {"DZ_Data", "DZ_Scripts", "JM_COT_Scripts", "SwarmObserver"};
+    };
+};
+
+class CfgMods
+{
+    class SwarmObserverCOT
+    {
+        dir = "SwarmObserverCOT";
+        picture = "";
+        action = "";
+        hideName = 1;
+        hidePicture = 1;
+        name = "SwarmObserverCOT";
+        credits = "";
+        author = "Swarm";
+        authorID = "0";
+        version = "%VERSION%";
+        extra = 0;
+        type = "mod";
+
+        dependencies[] = {"Game", "Mission"};
+
+        class defs
+        {
+            class gameScriptModule
+            {
+                value = "";
+                files[] = {"SwarmObserverCOT/scripts/3_Game"};
+            };
+            class missionScriptModule
+            {
+                value = "";
+                files[] = {"SwarmObserverCOT/scripts/5_Mission"};
+            };
+        };
+    };
+};
@@ -0,0 +1,7 @@
+protocol = 1;
+publishedid = 0;
+name = "SwarmObserverCOT";
+timestamp = 0;
+version = "%VERSION%";
+author = "Swarm";
+description = "Community Online Tools panels for SwarmObserver";
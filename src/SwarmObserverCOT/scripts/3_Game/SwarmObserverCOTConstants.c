@@ -0,0 +1,27 @@
+// SwarmObserver history RPC IDs for COT module
+enum JMSwarmObserverHistoryModuleRPC
+{
+	INVALID = 10520,
+	Query,       // Client -> Server: run a history query
+	QueryResult, // Server -> Client: one page of results
+	COUNT
+}
+
+// SwarmObserver dashboard RPC IDs for COT module
+enum JMSwarmObserverDashboardModuleRPC
+{
+	INVALID = 10530,
+	Subscribe,   // Client -> Server: panel opened, start sending updates
+	Unsubscribe, // Client -> Server: panel closed
+	Update,      // Server -> Client: changed and removed rows since the last update
+	COUNT
+}
+
+// SwarmObserverCOT constants
+class SwarmObserverCOTConstants
+{
+	// Dashboard
+	static const int DASHBOARD_UPDATE_INTERVAL_MS = 2000;    // Server diff and send rate (only while someone is subscribed)
+	static const int DASHBOARD_COUNTDOWN_REFRESH_MS = 1000;  // Client side countdown redraw, no network involved
+	static const int DASHBOARD_RECENT_VIOLATIONS = 10;
+}
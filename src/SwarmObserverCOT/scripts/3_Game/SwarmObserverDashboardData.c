@@ -0,0 +1,99 @@
+// Dashboard sections
+enum SwarmObserverDashboardSection
+{
+	COMBAT,
+	GRACE,
+	VIOLATION,
+	METRIC
+}
+
+// One dashboard line
+// ExpiresAt is an absolute server time (ms), so countdowns tick on the client and the row only changes with the state.
+class SwarmObserverDashboardRow
+{
+	string Key;
+	int Section;
+	string Label;
+	string Detail;
+	int ExpiresAt; // 0 for rows without a countdown
+	
+	void SwarmObserverDashboardRow(string key = "", int section = 0, string label = "", string detail = "", int expiresAt = 0)
+	{
+		Key = key;
+		Section = section;
+		Label = label;
+		Detail = detail;
+		ExpiresAt = expiresAt;
+	}
+	
+	// Everything the client displays, used by the server to detect changed rows
+	string GetSignature()
+	{
+		return Label + "|" + Detail + "|" + ExpiresAt;
+	}
+	
+	void Write(Serializer ctx)
+	{
+		ctx.Write(Key);
+		ctx.Write(Section);
+		ctx.Write(Label);
+		ctx.Write(Detail);
+		ctx.Write(ExpiresAt);
+	}
+	
+	bool Read(Serializer ctx)
+	{
+		return ctx.Read(Key) && ctx.Read(Section) && ctx.Read(Label) && ctx.Read(Detail) && ctx.Read(ExpiresAt);
+	}
+}
+
+// Rows added or changed and keys removed since the previous update (Full replaces everything the client has)
+class SwarmObserverDashboardDelta
+{
+	int ServerTime;
+	bool Full;
+	autoptr array<ref SwarmObserverDashboardRow> Upserts;
+	autoptr array<string> Removed;
+	
+	void SwarmObserverDashboardDelta(int serverTime = 0, bool full = false)
+	{
+		ServerTime = serverTime;
+		Full = full;
+		Upserts = new array<ref SwarmObserverDashboardRow>;
+		Removed = new array<string>;
+	}
+	
+	bool IsEmpty()
+	{
+		return !Full && Upserts.Count() == 0 && Removed.Count() == 0;
+	}
+	
+	void Write(Serializer ctx)
+	{
+		ctx.Write(ServerTime);
+		ctx.Write(Full);
+		ctx.Write(Removed);
+		ctx.Write(Upserts.Count());
+		foreach (SwarmObserverDashboardRow row : Upserts)
+		{
+			row.Write(ctx);
+		}
+	}
+	
+	bool Read(Serializer ctx)
+	{
+		int upsertCount;
+		if (!ctx.Read(ServerTime) || !ctx.Read(Full) || !ctx.Read(Removed) || !ctx.Read(upsertCount))
+			return false;
+		
+		for (int i = 0; i < upsertCount; i++)
+		{
+			SwarmObserverDashboardRow row = new SwarmObserverDashboardRow();
+			if (!row.Read(ctx))
+				return false;
+			
+			Upserts.Insert(row);
+		}
+		return true;
+	}
+}
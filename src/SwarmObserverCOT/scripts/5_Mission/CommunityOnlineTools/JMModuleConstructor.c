@@ -0,0 +1,12 @@
+// Register SwarmObserver modules with COT
+modded class JMModuleConstructor
+{
+	override void RegisterModules(out TTypenameArray modules)
+	{
+		super.RegisterModules(modules);
+		modules.Insert(JMSwarmObserverDashboardModule);
+		#ifndef SWARM_OBSERVER_NO_ZONES
+		modules.Insert(JMSwarmObserverHistoryModule);
+		#endif
+	}
+}
@@ -0,0 +1,141 @@
+// SwarmObserver Dashboard Form for Community Online Tools
+class JMSwarmObserverDashboardForm: JMFormBase
+{
+	protected UIActionScroller m_Scroller;
+	protected Widget m_ActionsParent;
+	
+	// One wrapper per SwarmObserverDashboardSection
+	protected ref array<Widget> m_SectionWrappers;
+	
+	// Rows and their widgets by key, updated in place as deltas arrive
+	protected ref map<string, ref SwarmObserverDashboardRow> m_Rows;
+	protected ref map<string, UIActionText> m_RowTexts;
+	
+	// Server time minus client time, so expiry times can be turned into local countdowns
+	protected int m_ServerTimeOffset;
+	
+	protected JMSwarmObserverDashboardModule m_Module;
+	
+	void JMSwarmObserverDashboardForm()
+	{
+		m_SectionWrappers = new array<Widget>;
+		m_Rows = new map<string, ref SwarmObserverDashboardRow>;
+		m_RowTexts = new map<string, UIActionText>;
+	}
+	
+	void ~JMSwarmObserverDashboardForm()
+	{
+		if (m_Module)
+			m_Module.OnDashboardDelta.Remove(OnDashboardDelta);
+		
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(RefreshCountdowns);
+	}
+	
+	protected override bool SetModule(JMRenderableModuleBase mdl)
+	{
+		if (!Class.CastTo(m_Module, mdl))
+			return false;
+		
+		m_Module.OnDashboardDelta.Insert(OnDashboardDelta);
+		return true;
+	}
+	
+	override void OnInit()
+	{
+		m_Scroller = UIActionManager.CreateScroller(layoutRoot.FindAnyWidget("panel"));
+		m_ActionsParent = m_Scroller.GetContentWidget();
+		
+		// Same order as SwarmObserverDashboardSection
+		AddSection("Combat states");
+		AddSection("Grace periods");
+		AddSection("Recent violations");
+		AddSection("Hot paths");
+	}
+	
+	protected void AddSection(string title)
+	{
+		UIActionManager.CreateText(m_ActionsParent, title, "");
+		m_SectionWrappers.Insert(UIActionManager.CreateActionRows(m_ActionsParent));
+	}
+	
+	override void OnShow()
+	{
+		super.OnShow();
+		
+		m_Module.Subscribe();
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).CallLater(RefreshCountdowns, SwarmObserverCOTConstants.DASHBOARD_COUNTDOWN_REFRESH_MS, true);
+	}
+	
+	override void OnHide()
+	{
+		super.OnHide();
+		
+		m_Module.Unsubscribe();
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(RefreshCountdowns);
+	}
+	
+	void OnDashboardDelta(SwarmObserverDashboardDelta delta)
+	{
+		m_ServerTimeOffset = delta.ServerTime - GetGame().GetTime();
+		
+		if (delta.Full)
+		{
+			foreach (string key, UIActionText text : m_RowTexts)
+			{
+				delete text.GetLayoutRoot();
+			}
+			m_RowTexts.Clear();
+			m_Rows.Clear();
+		}
+		
+		foreach (string removedKey : delta.Removed)
+		{
+			UIActionText removedText;
+			if (m_RowTexts.Find(removedKey, removedText))
+				delete removedText.GetLayoutRoot();
+			
+			m_RowTexts.Remove(removedKey);
+			m_Rows.Remove(removedKey);
+		}
+		
+		foreach (SwarmObserverDashboardRow row : delta.Upserts)
+		{
+			UIActionText rowText;
+			if (!m_RowTexts.Find(row.Key, rowText))
+			{
+				rowText = UIActionManager.CreateText(m_SectionWrappers[row.Section], row.Label, "");
+				m_RowTexts.Set(row.Key, rowText);
+			}
+			
+			m_Rows.Set(row.Key, row);
+			rowText.SetLabel(row.Label);
+			rowText.SetText(GetRowText(row));
+		}
+		
+		// Refresh scroller layout
+		m_Scroller.UpdateScroller();
+	}
+	
+	// Redraw countdowns locally (called by timer while the panel is visible)
+	void RefreshCountdowns()
+	{
+		foreach (string key, SwarmObserverDashboardRow row : m_Rows)
+		{
+			if (row.ExpiresAt == 0)
+				continue;
+			
+			UIActionText rowText;
+			if (m_RowTexts.Find(key, rowText))
+				rowText.SetText(GetRowText(row));
+		}
+	}
+	
+	protected string GetRowText(SwarmObserverDashboardRow row)
+	{
+		if (row.ExpiresAt == 0)
+			return row.Detail;
+		
+		int remaining = Math.Max(0, (row.ExpiresAt - GetGame().GetTime() - m_ServerTimeOffset) / 1000);
+		return row.Detail + " - " + remaining + "s left";
+	}
+}
@@ -0,0 +1,300 @@
+// SwarmObserver Dashboard Module for Community Online Tools
+// The server rebuilds the dashboard every DASHBOARD_UPDATE_INTERVAL_MS while at least one admin has the panel open,
+// and only sends the rows whose content changed. Countdowns are sent as expiry times, so a quiet server sends nothing.
+class JMSwarmObserverDashboardModule: JMRenderableModuleBase
+{
+	// Called on the client with each update received (SwarmObserverDashboardDelta)
+	ref ScriptInvoker OnDashboardDelta;
+	
+	// Server side subscription state
+	protected ref array<PlayerIdentity> m_Subscribers;
+	protected bool m_LocalSubscriber; // Listen server host
+	protected ref map<string, string> m_Signatures; // Rows as last published
+	protected bool m_TimerRunning;
+	
+	void JMSwarmObserverDashboardModule()
+	{
+		OnDashboardDelta = new ScriptInvoker();
+		m_Subscribers = new array<PlayerIdentity>;
+		m_Signatures = new map<string, string>;
+		
+		GetPermissionsManager().RegisterPermission("Admin.SwarmObserver");
+		GetPermissionsManager().RegisterPermission("Admin.SwarmObserver.Dashboard");
+	}
+	
+	override bool HasAccess()
+	{
+		return GetPermissionsManager().HasPermission("Admin.SwarmObserver.Dashboard");
+	}
+	
+	override string GetLayoutRoot()
+	{
+		return "SwarmObserverCOT/gui/layouts/SwarmObserverDashboard_form.layout";
+	}
+	
+	override string GetTitle()
+	{
+		return "Observer Dashboard";
+	}
+	
+	override string GetIconName()
+	{
+		return "SO";
+	}
+	
+	override bool ImageIsIcon()
+	{
+		return false;
+	}
+	
+	// RPC Setup
+	override int GetRPCMin()
+	{
+		return JMSwarmObserverDashboardModuleRPC.INVALID;
+	}
+	
+	override int GetRPCMax()
+	{
+		return JMSwarmObserverDashboardModuleRPC.COUNT;
+	}
+	
+	override void OnRPC(PlayerIdentity sender, Object target, int rpc_type, ParamsReadContext ctx)
+	{
+		switch (rpc_type)
+		{
+			case JMSwarmObserverDashboardModuleRPC.Subscribe:
+				RPC_Subscribe(ctx, sender, target);
+				break;
+			case JMSwarmObserverDashboardModuleRPC.Unsubscribe:
+				RPC_Unsubscribe(ctx, sender, target);
+				break;
+			case JMSwarmObserverDashboardModuleRPC.Update:
+				RPC_Update(ctx, sender, target);
+				break;
+		}
+	}
+	
+	// === Subscribe ===
+	void Subscribe()
+	{
+		if (IsMissionHost())
+		{
+			m_LocalSubscriber = true;
+			Exec_Subscribe(NULL);
+		}
+		else
+		{
+			ScriptRPC rpc = new ScriptRPC();
+			rpc.Send(NULL, JMSwarmObserverDashboardModuleRPC.Subscribe, true, NULL);
+		}
+	}
+	
+	private void RPC_Subscribe(ParamsReadContext ctx, PlayerIdentity senderRPC, Object target)
+	{
+		JMPlayerInstance instance;
+		if (!GetPermissionsManager().HasPermission("Admin.SwarmObserver.Dashboard", senderRPC, instance))
+			return;
+		
+		if (m_Subscribers.Find(senderRPC) == -1)
+			m_Subscribers.Insert(senderRPC);
+		
+		Exec_Subscribe(senderRPC);
+	}
+	
+	// Send the whole dashboard to the new subscriber, later updates only carry changes
+	// The other subscribers get the pending changes first, so the published signatures match the snapshot and the
+	// next update diffs every subscriber against the same rows
+	private void Exec_Subscribe(PlayerIdentity ident)
+	{
+		map<string, ref SwarmObserverDashboardRow> rows = new map<string, ref SwarmObserverDashboardRow>;
+		BuildRows(rows);
+		
+		SwarmObserverDashboardDelta changes = DiffRows(rows);
+		if (!changes.IsEmpty())
+			Broadcast(changes, ident, !ident);
+		
+		SwarmObserverDashboardDelta delta = new SwarmObserverDashboardDelta(GetGame().GetTime(), true);
+		foreach (string key, SwarmObserverDashboardRow row : rows)
+		{
+			delta.Upserts.Insert(row);
+		}
+		SendDelta(delta, ident);
+		
+		if (!m_TimerRunning)
+		{
+			m_TimerRunning = true;
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(PublishDashboard, SwarmObserverCOTConstants.DASHBOARD_UPDATE_INTERVAL_MS, true);
+		}
+	}
+	
+	// === Unsubscribe ===
+	void Unsubscribe()
+	{
+		if (IsMissionHost())
+		{
+			m_LocalSubscriber = false;
+		}
+		else
+		{
+			ScriptRPC rpc = new ScriptRPC();
+			rpc.Send(NULL, JMSwarmObserverDashboardModuleRPC.Unsubscribe, true, NULL);
+		}
+	}
+	
+	private void RPC_Unsubscribe(ParamsReadContext ctx, PlayerIdentity senderRPC, Object target)
+	{
+		m_Subscribers.RemoveItem(senderRPC);
+	}
+	
+	// === Update ===
+	// Diff the current rows against the last published ones and send the difference (called by timer)
+	void PublishDashboard()
+	{
+		// Disconnected admins leave null identities behind
+		for (int i = m_Subscribers.Count() - 1; i >= 0; i--)
+		{
+			if (!m_Subscribers[i])
+				m_Subscribers.Remove(i);
+		}
+		
+		if (m_Subscribers.Count() == 0 && !m_LocalSubscriber)
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(PublishDashboard);
+			m_TimerRunning = false;
+			m_Signatures.Clear();
+			return;
+		}
+		
+		map<string, ref SwarmObserverDashboardRow> rows = new map<string, ref SwarmObserverDashboardRow>;
+		BuildRows(rows);
+		
+		SwarmObserverDashboardDelta delta = DiffRows(rows);
+		if (!delta.IsEmpty())
+			Broadcast(delta, NULL, false);
+	}
+	
+	// Changes from the last published rows to these, m_Signatures is updated to match the rows
+	protected SwarmObserverDashboardDelta DiffRows(map<string, ref SwarmObserverDashboardRow> rows)
+	{
+		SwarmObserverDashboardDelta delta = new SwarmObserverDashboardDelta(GetGame().GetTime(), false);
+		foreach (string key, SwarmObserverDashboardRow row : rows)
+		{
+			string signature = row.GetSignature();
+			string previous;
+			if (!m_Signatures.Find(key, previous) || previous != signature)
+			{
+				delta.Upserts.Insert(row);
+				m_Signatures.Set(key, signature);
+			}
+		}
+		
+		foreach (string publishedKey, string publishedSignature : m_Signatures)
+		{
+			if (!rows.Contains(publishedKey))
+				delta.Removed.Insert(publishedKey);
+		}
+		
+		foreach (string removedKey : delta.Removed)
+		{
+			m_Signatures.Remove(removedKey);
+		}
+		
+		return delta;
+	}
+	
+	// Send a delta to every subscriber, except skip and the local host when skipLocal is set
+	protected void Broadcast(SwarmObserverDashboardDelta delta, PlayerIdentity skip, bool skipLocal)
+	{
+		if (m_LocalSubscriber && !skipLocal)
+			SendDelta(delta, NULL);
+		
+		foreach (PlayerIdentity subscriber : m_Subscribers)
+		{
+			if (subscriber && subscriber != skip)
+				SendDelta(delta, subscriber);
+		}
+	}
+	
+	private void SendDelta(SwarmObserverDashboardDelta delta, PlayerIdentity ident)
+	{
+		if (!ident)
+		{
+			OnDashboardDelta.Invoke(delta);
+			return;
+		}
+		
+		ScriptRPC rpc = new ScriptRPC();
+		delta.Write(rpc);
+		rpc.Send(NULL, JMSwarmObserverDashboardModuleRPC.Update, true, ident);
+	}
+	
+	// Client receives the changes since the previous update
+	private void RPC_Update(ParamsReadContext ctx, PlayerIdentity senderRPC, Object target)
+	{
+		if (GetGame().IsDedicatedServer())
+			return;
+		
+		SwarmObserverDashboardDelta delta = new SwarmObserverDashboardDelta();
+		if (!delta.Read(ctx))
+			return;
+		
+		OnDashboardDelta.Invoke(delta);
+	}
+	
+	// Current dashboard content, keyed so the same entity keeps the same row across updates
+	protected void BuildRows(map<string, ref SwarmObserverDashboardRow> rows)
+	{
+		SwarmObserverSettingsSnapshot settings = SwarmObserverSettingsSnapshot.Get();
+		int currentTime = GetGame().GetTime();
+		
+		#ifndef SWARM_OBSERVER_NO_COMBAT
+		SwarmObserverIdentityTable identities = SwarmObserverIdentityTable.GetInstance();
+		foreach (PlayerBase player, CombatState state : GetCombatStateManager().GetCombatStates())
+		{
+			if (!player || state.IsExpired(currentTime, settings.CombatDurationMs))
+				continue;
+			
+			int handle = player.GetSwarmObserverHandle();
+			string involved = "";
+			foreach (int involvedHandle : state.m_InvolvedPlayers)
+			{
+				if (involved != "")
+					involved += ", ";
+				involved += identities.GetName(involvedHandle);
+			}
+			
+			string combatKey = "C" + handle;
+			string combatDetail = "vs " + involved + " (" + state.m_CombatActions.Count() + " actions)";
+			rows.Set(combatKey, new SwarmObserverDashboardRow(combatKey, SwarmObserverDashboardSection.COMBAT, identities.GetName(handle), combatDetail, state.m_LastCombatActionTime + settings.CombatDurationMs));
+		}
+		#endif
+		
+		#ifndef SWARM_OBSERVER_NO_ZONES
+		foreach (string steamID, SwarmObserverGracePeriodData grace : SwarmObserverGracePeriodManager.GetActiveGracePeriods())
+		{
+			string graceKey = "G" + steamID;
+			rows.Set(graceKey, new SwarmObserverDashboardRow(graceKey, SwarmObserverDashboardSection.GRACE, grace.PlayerName, grace.AreaName, grace.DisconnectTimestamp + settings.GracePeriodMs));
+		}
+		
+		array<SwarmObserverHistoryIndexEntry> recent = new array<SwarmObserverHistoryIndexEntry>;
+		SwarmObserverHistory.GetRecentViolations(SwarmObserverCOTConstants.DASHBOARD_RECENT_VIOLATIONS, recent);
+		foreach (SwarmObserverHistoryIndexEntry entry : recent)
+		{
+			string playerName = entry.SteamID;
+			SwarmObserverPlayerRecord record = SwarmObserverHistory.GetPlayerRecord(entry.SteamID);
+			if (record)
+				playerName = record.PlayerName;
+			
+			string violationKey = "V" + entry.SteamID + "|" + entry.Timestamp;
+			rows.Set(violationKey, new SwarmObserverDashboardRow(violationKey, SwarmObserverDashboardSection.VIOLATION, playerName, entry.Timestamp + " in " + entry.AreaName));
+		}
+		#endif
+		
+		for (int metric = 0; metric < SwarmObserverMetric.COUNT; metric++)
+		{
+			string metricKey = "M" + metric;
+			string metricDetail = string.Format("%1 calls, avg %2 ms, max %3 ms", SwarmObserverMetrics.GetCalls(metric), SwarmObserverMetrics.GetAverageMs(metric).ToString(), SwarmObserverMetrics.GetMaxMs(metric).ToString());
+			rows.Set(metricKey, new SwarmObserverDashboardRow(metricKey, SwarmObserverDashboardSection.METRIC, SwarmObserverMetrics.GetName(metric), metricDetail));
+		}
+	}
+}
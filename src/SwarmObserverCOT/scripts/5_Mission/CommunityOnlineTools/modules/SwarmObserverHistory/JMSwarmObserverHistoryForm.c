@@ -0,0 +1,189 @@
+#ifndef SWARM_OBSERVER_NO_ZONES
+// SwarmObserver History Form for Community Online Tools
+class JMSwarmObserverHistoryForm: JMFormBase
+{
+	protected UIActionScroller m_Scroller;
+	protected Widget m_ActionsParent;
+	
+	protected UIActionEditableText m_SteamIDBox;
+	protected UIActionEditableText m_AreaBox;
+	protected UIActionEditableText m_FromBox;
+	protected UIActionEditableText m_ToBox;
+	protected UIActionEditableText m_MinCountBox;
+	protected UIActionButton m_SearchButton;
+	
+	protected Widget m_ResultsWrapper;
+	
+	protected UIActionButton m_PrevPageButton;
+	protected UIActionButton m_NextPageButton;
+	protected UIActionText m_PageInfo;
+	
+	// Cursors of the pages already visited (index = page number), the server only keeps what we send back
+	protected ref array<string> m_PageCursors;
+	protected ref SwarmObserverHistoryQuery m_Query;
+	protected string m_NextCursor;
+	protected int m_CurrentPage = 0;
+	
+	protected JMSwarmObserverHistoryModule m_Module;
+	
+	void JMSwarmObserverHistoryForm()
+	{
+		m_PageCursors = new array<string>;
+		m_Query = new SwarmObserverHistoryQuery();
+	}
+	
+	void ~JMSwarmObserverHistoryForm()
+	{
+		if (m_Module)
+			m_Module.OnQueryResult.Remove(OnQueryResult);
+	}
+	
+	protected override bool SetModule(JMRenderableModuleBase mdl)
+	{
+		if (!Class.CastTo(m_Module, mdl))
+			return false;
+		
+		m_Module.OnQueryResult.Insert(OnQueryResult);
+		return true;
+	}
+	
+	override void OnInit()
+	{
+		m_Scroller = UIActionManager.CreateScroller(layoutRoot.FindAnyWidget("panel"));
+		m_ActionsParent = m_Scroller.GetContentWidget();
+		
+		// Filters (only applied on Search, so typing does not send a query per key press)
+		m_SteamIDBox = UIActionManager.CreateEditableText(m_ActionsParent, "Steam ID starts with:");
+		m_AreaBox = UIActionManager.CreateEditableText(m_ActionsParent, "Area:");
+		m_FromBox = UIActionManager.CreateEditableText(m_ActionsParent, "From (dd/mm/yyyy):");
+		m_ToBox = UIActionManager.CreateEditableText(m_ActionsParent, "To (dd/mm/yyyy):");
+		m_MinCountBox = UIActionManager.CreateEditableText(m_ActionsParent, "Minimum count:");
+		m_MinCountBox.SetOnlyNumbers(true);
+		m_SearchButton = UIActionManager.CreateButton(m_ActionsParent, "Search", this, "OnClick_Search");
+		
+		// Results wrapper - will hold one text row per player
+		m_ResultsWrapper = UIActionManager.CreateActionRows(m_ActionsParent);
+		
+		// Navigation
+		Widget navGrid = UIActionManager.CreateGridSpacer(m_ActionsParent, 1, 3);
+		m_PrevPageButton = UIActionManager.CreateButton(navGrid, "Previous", this, "OnClick_PrevPage");
+		m_PageInfo = UIActionManager.CreateText(navGrid, "", "");
+		m_NextPageButton = UIActionManager.CreateButton(navGrid, "Next", this, "OnClick_NextPage");
+		
+		UpdatePageInfo();
+	}
+	
+	override void OnShow()
+	{
+		super.OnShow();
+		
+		Search();
+	}
+	
+	// Start a new query from the first page with the current filters
+	void Search()
+	{
+		m_Query.SteamIDPrefix = m_SteamIDBox.GetText();
+		m_Query.AreaName = m_AreaBox.GetText();
+		m_Query.From = m_FromBox.GetText();
+		m_Query.To = m_ToBox.GetText();
+		m_Query.MinCount = m_MinCountBox.GetText().ToInt();
+		
+		m_PageCursors.Clear();
+		m_PageCursors.Insert("");
+		m_CurrentPage = 0;
+		RequestPage();
+	}
+	
+	void RequestPage()
+	{
+		m_Query.Cursor = m_PageCursors[m_CurrentPage];
+		m_PrevPageButton.Disable();
+		m_NextPageButton.Disable();
+		m_Module.Query(m_Query);
+	}
+	
+	void OnQueryResult(SwarmObserverHistoryQueryPage page)
+	{
+		// Clear existing rows by deleting children of wrapper
+		Widget child = m_ResultsWrapper.GetChildren();
+		while (child)
+		{
+			Widget next = child.GetSibling();
+			delete child;
+			child = next;
+		}
+		
+		foreach (SwarmObserverHistoryQueryRow row : page.Rows)
+		{
+			string label = row.PlayerName + " (" + row.SteamID + ")";
+			string value = string.Format("%1x, last %2 in %3", row.Count, row.LastTimestamp, row.LastAreaName);
+			UIActionManager.CreateText(m_ResultsWrapper, label, value);
+		}
+		
+		if (page.Rows.Count() == 0)
+			UIActionManager.CreateText(m_ResultsWrapper, "No matching players", "");
+		
+		m_NextCursor = page.NextCursor;
+		UpdatePageInfo();
+		
+		// Refresh scroller layout
+		m_Scroller.UpdateScroller();
+	}
+	
+	void UpdatePageInfo()
+	{
+		string pageText = "Page " + (m_CurrentPage + 1);
+		if (m_NextCursor != "")
+			pageText += "+";
+		m_PageInfo.SetText(pageText);
+		
+		if (m_CurrentPage > 0)
+			m_PrevPageButton.Enable();
+		else
+			m_PrevPageButton.Disable();
+		
+		if (m_NextCursor != "")
+			m_NextPageButton.Enable();
+		else
+			m_NextPageButton.Disable();
+	}
+	
+	void OnClick_Search(UIEvent eid, UIActionBase action)
+	{
+		if (eid != UIEvent.CLICK)
+			return;
+		
+		Search();
+	}
+	
+	void OnClick_PrevPage(UIEvent eid, UIActionBase action)
+	{
+		if (eid != UIEvent.CLICK)
+			return;
+		
+		if (m_CurrentPage > 0)
+		{
+			m_CurrentPage--;
+			RequestPage();
+		}
+	}
+	
+	void OnClick_NextPage(UIEvent eid, UIActionBase action)
+	{
+		if (eid != UIEvent.CLICK)
+			return;
+		
+		if (m_NextCursor == "")
+			return;
+		
+		m_CurrentPage++;
+		if (m_CurrentPage < m_PageCursors.Count())
+			m_PageCursors[m_CurrentPage] = m_NextCursor;
+		else
+			m_PageCursors.Insert(m_NextCursor);
+		
+		RequestPage();
+	}
+}
+#endif
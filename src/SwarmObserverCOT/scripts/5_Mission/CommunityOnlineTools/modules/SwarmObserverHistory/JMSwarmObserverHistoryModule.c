@@ -0,0 +1,112 @@
+#ifndef SWARM_OBSERVER_NO_ZONES
+// SwarmObserver History Module for Community Online Tools
+// Queries run on the server against the history indexes, only the requested page is sent back.
+class JMSwarmObserverHistoryModule: JMRenderableModuleBase
+{
+	// Called on the client with each page received (SwarmObserverHistoryQueryPage)
+	ref ScriptInvoker OnQueryResult;
+	
+	void JMSwarmObserverHistoryModule()
+	{
+		OnQueryResult = new ScriptInvoker();
+		
+		GetPermissionsManager().RegisterPermission("Admin.SwarmObserver");
+		GetPermissionsManager().RegisterPermission("Admin.SwarmObserver.History");
+	}
+	
+	override bool HasAccess()
+	{
+		return GetPermissionsManager().HasPermission("Admin.SwarmObserver.History");
+	}
+	
+	override string GetLayoutRoot()
+	{
+		return "SwarmObserverCOT/gui/layouts/SwarmObserverHistory_form.layout";
+	}
+	
+	override string GetTitle()
+	{
+		return "Disconnect History";
+	}
+	
+	override string GetIconName()
+	{
+		return "SH";
+	}
+	
+	override bool ImageIsIcon()
+	{
+		return false;
+	}
+	
+	// RPC Setup
+	override int GetRPCMin()
+	{
+		return JMSwarmObserverHistoryModuleRPC.INVALID;
+	}
+	
+	override int GetRPCMax()
+	{
+		return JMSwarmObserverHistoryModuleRPC.COUNT;
+	}
+	
+	override void OnRPC(PlayerIdentity sender, Object target, int rpc_type, ParamsReadContext ctx)
+	{
+		switch (rpc_type)
+		{
+			case JMSwarmObserverHistoryModuleRPC.Query:
+				RPC_Query(ctx, sender, target);
+				break;
+			case JMSwarmObserverHistoryModuleRPC.QueryResult:
+				RPC_QueryResult(ctx, sender, target);
+				break;
+		}
+	}
+	
+	// === Query ===
+	void Query(SwarmObserverHistoryQuery query)
+	{
+		if (IsMissionHost())
+		{
+			OnQueryResult.Invoke(SwarmObserverHistory.Query(query));
+		}
+		else
+		{
+			ScriptRPC rpc = new ScriptRPC();
+			query.Write(rpc);
+			rpc.Send(NULL, JMSwarmObserverHistoryModuleRPC.Query, true, NULL);
+		}
+	}
+	
+	private void RPC_Query(ParamsReadContext ctx, PlayerIdentity senderRPC, Object target)
+	{
+		SwarmObserverHistoryQuery query = new SwarmObserverHistoryQuery();
+		if (!query.Read(ctx))
+			return;
+		
+		JMPlayerInstance instance;
+		if (!GetPermissionsManager().HasPermission("Admin.SwarmObserver.History", senderRPC, instance))
+			return;
+		
+		SwarmObserverHistoryQueryPage page = SwarmObserverHistory.Query(query);
+		Print("[SwarmObserver] History query from " + senderRPC.GetName() + ": " + page.Rows.Count() + " rows, " + page.Scanned + " entries scanned");
+		
+		ScriptRPC rpc = new ScriptRPC();
+		page.Write(rpc);
+		rpc.Send(NULL, JMSwarmObserverHistoryModuleRPC.QueryResult, true, senderRPC);
+	}
+	
+	// Client receives one page of results
+	private void RPC_QueryResult(ParamsReadContext ctx, PlayerIdentity senderRPC, Object target)
+	{
+		if (GetGame().IsDedicatedServer())
+			return;
+		
+		SwarmObserverHistoryQueryPage page = new SwarmObserverHistoryQueryPage();
+		if (!page.Read(ctx))
+			return;
+		
+		OnQueryResult.Invoke(page);
+	}
+}
+#endif
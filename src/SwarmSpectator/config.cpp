@@ -10,7 +10,7 @@ class CfgPatches
         units[] = {};
         weapons[] = {};
         requiredVersion = 0.1;
-        requiredAddons[] = {"JM_COT_Scripts"};
+        requiredAddons[] = {"JM_COT_Scripts", "SwarmCore"};
     };
 };
 
@@ -0,0 +1,288 @@
+// One keyframe as written in a path file
+class SwarmCameraPathKey
+{
+    vector Position;
+    vector Orientation; // yaw, pitch, roll in degrees, unwrapped so neighbouring keys never jump by 360
+    float FOV;
+
+    void SwarmCameraPathKey(vector position = "0 0 0", vector orientation = "0 0 0", float fov = 0)
+    {
+        Position = position;
+        Orientation = orientation;
+        FOV = fov;
+    }
+}
+
+// A saved camera path, $profile:SwarmSpectator\paths\<name>.json
+// Keys are evenly spaced KeyInterval seconds apart
+class SwarmCameraPathData
+{
+    float KeyInterval;
+    ref array<ref SwarmCameraPathKey> Keys;
+
+    void SwarmCameraPathData()
+    {
+        Keys = new array<ref SwarmCameraPathKey>;
+    }
+}
+
+// Records the camera into a ring buffer that is allocated once, so recording never allocates
+// Frames closer than MIN_SAMPLE_INTERVAL to the last sample are skipped, so the buffer always covers
+// RECORD_CAPACITY * MIN_SAMPLE_INTERVAL seconds (5 minutes) whatever the frame rate. When it is full the oldest
+// samples are overwritten.
+class SwarmCameraPathRecorder
+{
+    static const float MIN_SAMPLE_INTERVAL = 1.0 / 60.0;
+    static const int RECORD_CAPACITY = 18000; // 5 minutes of samples at MIN_SAMPLE_INTERVAL
+    static const float KEY_INTERVAL = 0.1;    // Seconds between keyframes in a saved path
+
+    protected ref array<float> m_Times;
+    protected ref array<vector> m_Positions;
+    protected ref array<vector> m_Orientations;
+    protected ref array<float> m_FOVs;
+
+    protected int m_Head;  // Next slot to write
+    protected int m_Count; // Valid samples, up to RECORD_CAPACITY
+    protected float m_Time;
+    protected float m_LastSampleTime;
+    protected bool m_Recording;
+
+    bool IsRecording()
+    {
+        return m_Recording;
+    }
+
+    int GetSampleCount()
+    {
+        return m_Count;
+    }
+
+    float GetDuration()
+    {
+        if (m_Count < 2)
+            return 0;
+        return m_Times[(m_Head - 1 + RECORD_CAPACITY) % RECORD_CAPACITY] - m_Times[Oldest()];
+    }
+
+    // Start a new recording, the buffer is only allocated the first time
+    void Start()
+    {
+        if (!m_Times)
+        {
+            m_Times = new array<float>;
+            m_Positions = new array<vector>;
+            m_Orientations = new array<vector>;
+            m_FOVs = new array<float>;
+            m_Times.Resize(RECORD_CAPACITY);
+            m_Positions.Resize(RECORD_CAPACITY);
+            m_Orientations.Resize(RECORD_CAPACITY);
+            m_FOVs.Resize(RECORD_CAPACITY);
+        }
+
+        m_Head = 0;
+        m_Count = 0;
+        m_Time = 0;
+        m_LastSampleTime = 0;
+        m_Recording = true;
+    }
+
+    void Stop()
+    {
+        m_Recording = false;
+    }
+
+    // Called every frame while recording
+    void Record(float timeslice, vector position, vector orientation, float fov)
+    {
+        if (m_Count > 0)
+        {
+            m_Time += timeslice;
+            if (m_Time - m_LastSampleTime < MIN_SAMPLE_INTERVAL)
+                return;
+        }
+        m_LastSampleTime = m_Time;
+
+        m_Times[m_Head] = m_Time;
+        m_Positions[m_Head] = position;
+        m_Orientations[m_Head] = orientation;
+        m_FOVs[m_Head] = fov;
+
+        m_Head = (m_Head + 1) % RECORD_CAPACITY;
+        if (m_Count < RECORD_CAPACITY)
+            m_Count++;
+    }
+
+    // Resample the recording into evenly spaced keyframes, this smooths out frame time jitter and keeps the file small
+    SwarmCameraPathData ToPath()
+    {
+        SwarmCameraPathData data = new SwarmCameraPathData();
+        data.KeyInterval = KEY_INTERVAL;
+        if (m_Count < 2)
+            return data;
+
+        int first = Oldest();
+        float start = m_Times[first];
+        float duration = GetDuration();
+
+        // Walk the samples once, unwrapping the angles as we go
+        int sample = 0;
+        vector prevOri = m_Orientations[first];
+        vector nextOri = Unwrap(prevOri, m_Orientations[(first + 1) % RECORD_CAPACITY]);
+
+        int keys = Math.Floor(duration / KEY_INTERVAL) + 1;
+        for (int k = 0; k < keys; k++)
+        {
+            float t = start + k * KEY_INTERVAL;
+
+            while (sample < m_Count - 2 && m_Times[(first + sample + 1) % RECORD_CAPACITY] < t)
+            {
+                sample++;
+                prevOri = nextOri;
+                nextOri = Unwrap(prevOri, m_Orientations[(first + sample + 1) % RECORD_CAPACITY]);
+            }
+
+            int a = (first + sample) % RECORD_CAPACITY;
+            int b = (first + sample + 1) % RECORD_CAPACITY;
+            float span = m_Times[b] - m_Times[a];
+            float f = 0;
+            if (span > 0)
+                f = Math.Clamp((t - m_Times[a]) / span, 0, 1);
+
+            vector pos = m_Positions[a] + (m_Positions[b] - m_Positions[a]) * f;
+            vector ori = prevOri + (nextOri - prevOri) * f;
+            float fov = Math.Lerp(m_FOVs[a], m_FOVs[b], f);
+            data.Keys.Insert(new SwarmCameraPathKey(pos, ori, fov));
+        }
+
+        return data;
+    }
+
+    protected int Oldest()
+    {
+        return (m_Head - m_Count + RECORD_CAPACITY) % RECORD_CAPACITY;
+    }
+
+    // Angles of next moved to within 180 degrees of prev
+    static vector Unwrap(vector prev, vector next)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            float delta = next[i] - prev[i];
+            while (delta > 180)
+                delta -= 360;
+            while (delta < -180)
+                delta += 360;
+            next[i] = prev[i] + delta;
+        }
+        return next;
+    }
+}
+
+// A loaded path, evaluated with a Catmull-Rom spline through the keyframes
+// Keys are evenly spaced, so finding the segment for a time is a division rather than a search.
+class SwarmCameraPath
+{
+    static const string DIR_PATHS = "$profile:SwarmSpectator\\paths\\";
+
+    protected ref array<vector> m_Positions;
+    protected ref array<vector> m_Orientations;
+    protected ref array<float> m_FOVs;
+    protected float m_KeyInterval;
+
+    void SwarmCameraPath()
+    {
+        m_Positions = new array<vector>;
+        m_Orientations = new array<vector>;
+        m_FOVs = new array<float>;
+    }
+
+    static string GetFileName(string name)
+    {
+        return DIR_PATHS + name + ".json";
+    }
+
+    static void Save(string name, SwarmCameraPathData data)
+    {
+        MakeDirectory("$profile:SwarmSpectator");
+        MakeDirectory(DIR_PATHS);
+        JsonFileLoader<SwarmCameraPathData>.JsonSaveFile(GetFileName(name), data);
+    }
+
+    // Returns null if the file does not exist or has fewer than two keys
+    static SwarmCameraPath Load(string name)
+    {
+        string file = GetFileName(name);
+        if (!FileExist(file))
+        {
+            Print("[SwarmSpectator] Camera path not found: " + file);
+            return null;
+        }
+
+        SwarmCameraPathData data = new SwarmCameraPathData();
+        JsonFileLoader<SwarmCameraPathData>.JsonLoadFile(file, data);
+
+        SwarmCameraPath path = new SwarmCameraPath();
+        if (!path.Compile(data))
+        {
+            Print("[SwarmSpectator] Camera path has too few keys: " + file);
+            return null;
+        }
+        return path;
+    }
+
+    bool Compile(SwarmCameraPathData data)
+    {
+        if (!data.Keys || data.Keys.Count() < 2 || data.KeyInterval <= 0)
+            return false;
+
+        m_KeyInterval = data.KeyInterval;
+        foreach (SwarmCameraPathKey key : data.Keys)
+        {
+            // Hand edited files may not be unwrapped
+            vector ori = key.Orientation;
+            if (m_Orientations.Count() > 0)
+                ori = SwarmCameraPathRecorder.Unwrap(m_Orientations[m_Orientations.Count() - 1], ori);
+
+            m_Positions.Insert(key.Position);
+            m_Orientations.Insert(ori);
+            m_FOVs.Insert(key.FOV);
+        }
+        return true;
+    }
+
+    float GetDuration()
+    {
+        return (m_Positions.Count() - 1) * m_KeyInterval;
+    }
+
+    // Camera pose at time (seconds from the start of the path, clamped to the path)
+    void Evaluate(float time, out vector position, out vector orientation, out float fov)
+    {
+        int last = m_Positions.Count() - 1;
+        float u = Math.Clamp(time / m_KeyInterval, 0, last);
+        int i1 = Math.Min(Math.Floor(u), last - 1);
+        float f = u - i1;
+
+        int i0 = Math.Max(i1 - 1, 0);
+        int i2 = i1 + 1;
+        int i3 = Math.Min(i1 + 2, last);
+
+        position = CatmullRom(m_Positions[i0], m_Positions[i1], m_Positions[i2], m_Positions[i3], f);
+        orientation = CatmullRom(m_Orientations[i0], m_Orientations[i1], m_Orientations[i2], m_Orientations[i3], f);
+        fov = CatmullRomFloat(m_FOVs[i0], m_FOVs[i1], m_FOVs[i2], m_FOVs[i3], f);
+    }
+
+    static vector CatmullRom(vector p0, vector p1, vector p2, vector p3, float t)
+    {
+        float t2 = t * t;
+        float t3 = t2 * t;
+        return ((p1 * 2) + (p2 - p0) * t + (p0 * 2 - p1 * 5 + p2 * 4 - p3) * t2 + (p1 * 3 - p0 - p2 * 3 + p3) * t3) * 0.5;
+    }
+
+    static float CatmullRomFloat(float p0, float p1, float p2, float p3, float t)
+    {
+        float t2 = t * t;
+        float t3 = t2 * t;
+        return ((2 * p1) + (p2 - p0) * t + (2 * p0 - 5 * p1 + 4 * p2 - p3) * t2 + (3 * p1 - p0 - 3 * p2 + p3) * t3) * 0.5;
+    }
+}
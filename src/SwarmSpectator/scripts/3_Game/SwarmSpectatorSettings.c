@@ -5,4 +5,8 @@ class SwarmSpectatorSettings
     
     // Static setting for camera lock-on behavior (default: true = lock on targets)
     static bool LockOnTarget = true;
+    
+    // Camera path used by the record, save and play controls and keybinds, and its playback speed (1 = as recorded)
+    static string PathName = "path";
+    static float PathSpeed = 1;
 }
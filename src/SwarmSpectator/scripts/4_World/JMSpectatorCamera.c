@@ -1,43 +1,67 @@
 modded class JMSpectatorCamera
 {
+    // The marker and light we switched off while ShowTargetMarker is disabled
+    // They stay in COT's members, so COT sees them as already created and never builds new ones
+    // Turning the marker back on just switches these on again
+    protected Particle m_Swarm_DormantMarker;
+    protected ScriptedLightBase m_Swarm_DormantLight;
+
     override void OnUpdate(float timeslice)
     {
         // If lock-on is disabled, clear the target before COT processes it
         // This prevents the camera from focusing on detected targets
-        if (!SwarmSpectatorSettings.LockOnTarget)
+        if (!SwarmSpectatorSettings.LockOnTarget && m_COT_LookAtTarget)
         {
             m_COT_LookAtTarget = null;
         }
-        
+
         // Run all original COT camera logic
         super.OnUpdate(timeslice);
-        
-        // After COT processing, check if we should hide the marker
+
         if (!SwarmSpectatorSettings.ShowTargetMarker)
         {
-            // Remove marker particle
-            if (m_COT_TargetMarker)
-            {
-                if (m_COT_TargetMarker.IsParticlePlaying())
-                    m_COT_TargetMarker.StopParticle();
-                m_COT_TargetMarker = null;
-            }
-            
-            // Remove light immediately (don't use FadeOut which takes 3 seconds)
-            if (m_COT_TargetLight)
-            {
-                m_COT_TargetLight.Destroy();
-                m_COT_TargetLight = null;
-            }
-            
-            m_COT_RemoveMarker = true;
+            // Only something COT created since last frame needs work, the dormant ones are left alone
+            if (m_COT_TargetMarker != m_Swarm_DormantMarker || m_COT_TargetLight != m_Swarm_DormantLight)
+                SuspendTargetMarker();
         }
-        
-        // If lock-on is disabled, also clear the target after processing
-        // to prevent it from persisting to the next frame
-        if (!SwarmSpectatorSettings.LockOnTarget)
+        else if (m_Swarm_DormantMarker || m_Swarm_DormantLight)
         {
-            m_COT_LookAtTarget = null;
+            ResumeTargetMarker();
+        }
+
+        // Record the camera or move it along a path, after COT so a playing path has the final say
+        SwarmCameraPathController.GetInstance().OnCameraUpdate(this, timeslice);
+    }
+
+    // Switch off the marker particle and light but keep them, so COT does not create them again next frame
+    protected void SuspendTargetMarker()
+    {
+        if (m_COT_TargetMarker != m_Swarm_DormantMarker)
+        {
+            if (m_COT_TargetMarker && m_COT_TargetMarker.IsParticlePlaying())
+                m_COT_TargetMarker.StopParticle();
+            m_Swarm_DormantMarker = m_COT_TargetMarker;
         }
+
+        // Switch the light off immediately (don't use FadeOut which takes 3 seconds and destroys it)
+        if (m_COT_TargetLight != m_Swarm_DormantLight)
+        {
+            if (m_COT_TargetLight)
+                m_COT_TargetLight.SetEnabled(false);
+            m_Swarm_DormantLight = m_COT_TargetLight;
+        }
+    }
+
+    // ShowTargetMarker was turned back on, reuse the dormant marker and light if COT still has them
+    protected void ResumeTargetMarker()
+    {
+        if (m_Swarm_DormantMarker && m_Swarm_DormantMarker == m_COT_TargetMarker && !m_Swarm_DormantMarker.IsParticlePlaying())
+            m_Swarm_DormantMarker.PlayParticle();
+
+        if (m_Swarm_DormantLight && m_Swarm_DormantLight == m_COT_TargetLight)
+            m_Swarm_DormantLight.SetEnabled(true);
+
+        m_Swarm_DormantMarker = null;
+        m_Swarm_DormantLight = null;
     }
 }
@@ -0,0 +1,154 @@
+// Records and plays back camera paths for the COT spectator camera, driven from JMSpectatorCamera.OnUpdate
+// Playback runs on a fixed PLAYBACK_STEP clock: frame time only fills an accumulator, the path is evaluated at
+// whole steps and the two steps around the current time are blended. A frame rate dip only changes how many steps
+// pass in one frame, never where the camera goes.
+class SwarmCameraPathController
+{
+    static const float PLAYBACK_STEP = 1.0 / 60.0; // Seconds of path time per step
+
+    private static ref SwarmCameraPathController s_Instance;
+
+    protected ref SwarmCameraPathRecorder m_Recorder;
+    protected ref SwarmCameraPath m_Path;
+
+    protected int m_Step;
+    protected float m_Accumulator;
+    protected float m_Speed = 1;
+
+    // Invoked when recording starts or stops, whoever started it (panel or keybind)
+    protected ref ScriptInvoker m_OnRecordingChanged;
+
+    void SwarmCameraPathController()
+    {
+        m_Recorder = new SwarmCameraPathRecorder();
+        m_OnRecordingChanged = new ScriptInvoker();
+    }
+
+    // Get singleton instance
+    static SwarmCameraPathController GetInstance()
+    {
+        if (!s_Instance)
+        {
+            s_Instance = new SwarmCameraPathController();
+        }
+        return s_Instance;
+    }
+
+    bool IsRecording()
+    {
+        return m_Recorder.IsRecording();
+    }
+
+    ScriptInvoker GetOnRecordingChanged()
+    {
+        return m_OnRecordingChanged;
+    }
+
+    bool IsPlaying()
+    {
+        return m_Path != null;
+    }
+
+    void StartRecording()
+    {
+        StopPlayback();
+        m_Recorder.Start();
+        Print("[SwarmSpectator] Recording camera path");
+        m_OnRecordingChanged.Invoke();
+    }
+
+    void StopRecording()
+    {
+        if (!m_Recorder.IsRecording())
+            return;
+
+        m_Recorder.Stop();
+        Print("[SwarmSpectator] Recorded " + m_Recorder.GetSampleCount() + " samples, " + m_Recorder.GetDuration() + "s");
+        m_OnRecordingChanged.Invoke();
+    }
+
+    // Save the last recording as a path file, returns false if there is nothing to save
+    bool Save(string name)
+    {
+        StopRecording();
+        if (name == "" || m_Recorder.GetSampleCount() < 2)
+            return false;
+
+        SwarmCameraPathData data = m_Recorder.ToPath();
+        SwarmCameraPath.Save(name, data);
+        Print("[SwarmSpectator] Saved camera path " + SwarmCameraPath.GetFileName(name) + " (" + data.Keys.Count() + " keys)");
+        return true;
+    }
+
+    // Play a saved path, speed 1 is the recorded speed
+    bool Play(string name, float speed = 1)
+    {
+        StopRecording();
+
+        SwarmCameraPath path = SwarmCameraPath.Load(name);
+        if (!path)
+            return false;
+
+        m_Path = path;
+        m_Speed = Math.Max(speed, 0.05);
+        m_Step = 0;
+        m_Accumulator = 0;
+        return true;
+    }
+
+    void StopPlayback()
+    {
+        m_Path = null;
+    }
+
+    // Called every frame by the spectator camera after COT has moved it
+    void OnCameraUpdate(Camera camera, float timeslice)
+    {
+        if (m_Recorder.IsRecording())
+        {
+            m_Recorder.Record(timeslice, camera.GetPosition(), camera.GetOrientation(), camera.GetCurrentFOV());
+            return;
+        }
+
+        if (!m_Path)
+            return;
+
+        m_Accumulator += timeslice * m_Speed;
+        while (m_Accumulator >= PLAYBACK_STEP)
+        {
+            m_Accumulator -= PLAYBACK_STEP;
+            m_Step++;
+        }
+
+        float duration = m_Path.GetDuration();
+        float time = m_Step * PLAYBACK_STEP;
+        float alpha = m_Accumulator / PLAYBACK_STEP;
+
+        vector pos;
+        vector ori;
+        float fov;
+        if (time >= duration)
+        {
+            // Land exactly on the last key and hand the camera back
+            m_Path.Evaluate(duration, pos, ori, fov);
+            StopPlayback();
+        }
+        else
+        {
+            vector nextPos;
+            vector nextOri;
+            float nextFov;
+            m_Path.Evaluate(time, pos, ori, fov);
+            m_Path.Evaluate(Math.Min(time + PLAYBACK_STEP, duration), nextPos, nextOri, nextFov);
+
+            pos = pos + (nextPos - pos) * alpha;
+            ori = ori + (nextOri - ori) * alpha;
+            fov = Math.Lerp(fov, nextFov, alpha);
+        }
+
+        camera.SetPosition(pos);
+        camera.SetOrientation(ori);
+        if (fov > 0)
+            camera.SetFOV(fov);
+    }
+}
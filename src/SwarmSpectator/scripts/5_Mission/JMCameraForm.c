@@ -2,6 +2,15 @@ modded class JMCameraForm
 {
     private UIActionCheckbox m_ShowTargetMarker;
     private UIActionCheckbox m_LockOnTarget;
+    private UIActionEditableText m_PathName;
+    private UIActionEditableText m_PathSpeed;
+    private UIActionButton m_PathRecordButton;
+
+    // The path controller outlives the form, so the form unsubscribes itself when it goes away
+    void ~JMCameraForm()
+    {
+        SwarmCameraPathController.GetInstance().GetOnRecordingChanged().Remove(OnPathRecordingChanged);
+    }
 
     override void InitCameraEffects()
     {
@@ -13,6 +22,18 @@ modded class JMCameraForm
         {
             m_LockOnTarget = UIActionManager.CreateCheckbox(content, "Lock On Target (Dolly Cam)", this, "OnClick_LockOnTarget", SwarmSpectatorSettings.LockOnTarget);
             m_ShowTargetMarker = UIActionManager.CreateCheckbox(content, "Show Target Marker (Dolly Cam)", this, "OnClick_ShowTargetMarker", SwarmSpectatorSettings.ShowTargetMarker);
+            
+            // Camera path recorder, paths are saved to $profile:SwarmSpectator\paths\<name>.json
+            m_PathName = UIActionManager.CreateEditableText(content, "Camera Path:", this, "OnChange_PathName");
+            m_PathName.SetText(SwarmSpectatorSettings.PathName);
+            m_PathSpeed = UIActionManager.CreateEditableText(content, "Path Speed:", this, "OnChange_PathSpeed");
+            m_PathSpeed.SetText(SwarmSpectatorSettings.PathSpeed.ToString());
+            
+            Widget pathGrid = UIActionManager.CreateGridSpacer(content, 1, 3);
+            m_PathRecordButton = UIActionManager.CreateButton(pathGrid, GetRecordLabel(), this, "OnClick_PathRecord");
+            SwarmCameraPathController.GetInstance().GetOnRecordingChanged().Insert(OnPathRecordingChanged);
+            UIActionManager.CreateButton(pathGrid, "Play Path", this, "OnClick_PathPlay");
+            UIActionManager.CreateButton(pathGrid, "Stop Path", this, "OnClick_PathStop");
         }
     }
 
@@ -33,4 +54,65 @@ modded class JMCameraForm
         // Update the static setting
         SwarmSpectatorSettings.LockOnTarget = action.IsChecked();
     }
+
+    void OnChange_PathName(UIEvent eid, UIActionBase action)
+    {
+        if (eid != UIEvent.CHANGE)
+            return;
+
+        SwarmSpectatorSettings.PathName = m_PathName.GetText();
+    }
+
+    void OnChange_PathSpeed(UIEvent eid, UIActionBase action)
+    {
+        if (eid != UIEvent.CHANGE)
+            return;
+
+        float speed = m_PathSpeed.GetText().ToFloat();
+        if (speed > 0)
+            SwarmSpectatorSettings.PathSpeed = speed;
+    }
+
+    // Start recording, or stop and save it under the path name
+    void OnClick_PathRecord(UIEvent eid, UIActionBase action)
+    {
+        if (eid != UIEvent.CLICK)
+            return;
+
+        SwarmCameraPathController paths = SwarmCameraPathController.GetInstance();
+        if (paths.IsRecording())
+            paths.Save(SwarmSpectatorSettings.PathName);
+        else
+            paths.StartRecording();
+    }
+
+    void OnClick_PathPlay(UIEvent eid, UIActionBase action)
+    {
+        if (eid != UIEvent.CLICK)
+            return;
+
+        SwarmCameraPathController.GetInstance().Play(SwarmSpectatorSettings.PathName, SwarmSpectatorSettings.PathSpeed);
+    }
+
+    void OnClick_PathStop(UIEvent eid, UIActionBase action)
+    {
+        if (eid != UIEvent.CLICK)
+            return;
+
+        SwarmCameraPathController.GetInstance().StopPlayback();
+    }
+
+    // Keeps the record button right when recording is toggled with the keybind
+    void OnPathRecordingChanged()
+    {
+        if (m_PathRecordButton)
+            m_PathRecordButton.SetButton(GetRecordLabel());
+    }
+
+    private string GetRecordLabel()
+    {
+        if (SwarmCameraPathController.GetInstance().IsRecording())
+            return "Stop And Save";
+        return "Record Path";
+    }
 }
@@ -1,13 +1,39 @@
 modded class MissionGameplay
 {
-    override void OnUpdate(float timeslice)
+    override void OnInit()
     {
-        super.OnUpdate(timeslice);
+        super.OnInit();
         
         // Toggle Lock On Target with hotkey (only when no menu is open)
-        if (GetGame().GetInput().LocalPress("UASwarmSpectatorToggleLockOn") && GetGame().GetUIManager().GetMenu() == NULL)
-        {
-            SwarmSpectatorSettings.LockOnTarget = !SwarmSpectatorSettings.LockOnTarget;
-        }
+        SwarmInputDispatcher.GetInstance().Bind("UASwarmSpectatorToggleLockOn", SwarmInputEvent.PRESS, SwarmInputContext.NO_MENU).Insert(OnSwarmSpectatorToggleLockOn);
+        
+        // Camera path recording and playback (unbound by default)
+        SwarmInputDispatcher.GetInstance().Bind("UASwarmSpectatorPathRecord", SwarmInputEvent.PRESS, SwarmInputContext.NO_MENU).Insert(OnSwarmSpectatorPathRecord);
+        SwarmInputDispatcher.GetInstance().Bind("UASwarmSpectatorPathPlay", SwarmInputEvent.PRESS, SwarmInputContext.NO_MENU).Insert(OnSwarmSpectatorPathPlay);
+    }
+    
+    void OnSwarmSpectatorToggleLockOn()
+    {
+        SwarmSpectatorSettings.LockOnTarget = !SwarmSpectatorSettings.LockOnTarget;
+    }
+    
+    // Start recording, or stop and save to the current path name
+    void OnSwarmSpectatorPathRecord()
+    {
+        SwarmCameraPathController paths = SwarmCameraPathController.GetInstance();
+        if (paths.IsRecording())
+            paths.Save(SwarmSpectatorSettings.PathName);
+        else
+            paths.StartRecording();
+    }
+    
+    // Play the current path, or stop it if it is playing
+    void OnSwarmSpectatorPathPlay()
+    {
+        SwarmCameraPathController paths = SwarmCameraPathController.GetInstance();
+        if (paths.IsPlaying())
+            paths.StopPlayback();
+        else
+            paths.Play(SwarmSpectatorSettings.PathName, SwarmSpectatorSettings.PathSpeed);
     }
 }
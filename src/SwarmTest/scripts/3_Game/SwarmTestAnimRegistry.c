@@ -0,0 +1,186 @@
+// Trigram index over lowercased animation names and descriptions
+// A search only verifies the animations listed under the query's rarest trigram, so results match a plain
+// substring scan of name and description. Queries shorter than a trigram fall back to that scan.
+class SwarmTestAnimSearchIndex
+{
+	protected ref map<string, ref array<int>> m_Postings; // Trigram -> animation indexes, ascending
+	
+	void SwarmTestAnimSearchIndex(array<ref SwarmTestAnimInfo> anims)
+	{
+		m_Postings = new map<string, ref array<int>>;
+		
+		set<string> grams = new set<string>;
+		for (int i = 0; i < anims.Count(); i++)
+		{
+			grams.Clear();
+			AddTrigrams(anims[i].m_LowerName, grams);
+			AddTrigrams(anims[i].m_LowerDescription, grams);
+			
+			for (int g = 0; g < grams.Count(); g++)
+			{
+				array<int> posting;
+				if (!m_Postings.Find(grams.Get(g), posting))
+				{
+					posting = new array<int>;
+					m_Postings.Set(grams.Get(g), posting);
+				}
+				posting.Insert(i);
+			}
+		}
+	}
+	
+	protected static void AddTrigrams(string text, set<string> grams)
+	{
+		for (int i = 0; i + 3 <= text.Length(); i++)
+		{
+			grams.Insert(text.Substring(i, 3));
+		}
+	}
+	
+	// Append the animations whose name or description contains term (lowercase) to results, in table order
+	void Search(string term, array<ref SwarmTestAnimInfo> anims, array<ref SwarmTestAnimInfo> results)
+	{
+		if (term.Length() < 3)
+		{
+			Filter(term, anims, results);
+			return;
+		}
+		
+		// Every match contains all of the query's trigrams, so the shortest posting list bounds the candidates
+		array<int> candidates;
+		for (int i = 0; i + 3 <= term.Length(); i++)
+		{
+			array<int> posting;
+			if (!m_Postings.Find(term.Substring(i, 3), posting))
+				return;
+			
+			if (!candidates || posting.Count() < candidates.Count())
+				candidates = posting;
+		}
+		
+		foreach (int index : candidates)
+		{
+			SwarmTestAnimInfo anim = anims[index];
+			if (anim.m_LowerName.Contains(term) || anim.m_LowerDescription.Contains(term))
+				results.Insert(anim);
+		}
+	}
+	
+	// Plain substring filter (short queries, and narrowing a previous result set)
+	static void Filter(string term, array<ref SwarmTestAnimInfo> anims, array<ref SwarmTestAnimInfo> results)
+	{
+		foreach (SwarmTestAnimInfo anim : anims)
+		{
+			if (anim.m_LowerName.Contains(term) || anim.m_LowerDescription.Contains(term))
+				results.Insert(anim);
+		}
+	}
+}
+
+// Animation registry - the animation table built once, with lookup indexes
+// Names are matched case-insensitively. When several animations share a command ID, the first one in the table wins.
+class SwarmTestAnimRegistry
+{
+	private static ref SwarmTestAnimRegistry s_Instance;
+	
+	protected ref array<ref SwarmTestAnimInfo> m_All;
+	protected ref map<string, SwarmTestAnimInfo> m_ByName;
+	protected ref map<int, SwarmTestAnimInfo> m_ByCommandID;
+	protected ref map<int, ref array<ref SwarmTestAnimInfo>> m_ByType;
+	protected ref SwarmTestAnimSearchIndex m_SearchIndex;
+	protected string m_ListText;
+	
+	void SwarmTestAnimRegistry()
+	{
+		m_All = SwarmTestConstants.CreateAnimationTable();
+		m_ByName = new map<string, SwarmTestAnimInfo>;
+		m_ByCommandID = new map<int, SwarmTestAnimInfo>;
+		m_ByType = new map<int, ref array<ref SwarmTestAnimInfo>>;
+		m_ListText = "=== Available Animations ===\n";
+		
+		foreach (SwarmTestAnimInfo anim : m_All)
+		{
+			if (!m_ByName.Contains(anim.m_LowerName))
+				m_ByName.Set(anim.m_LowerName, anim);
+			
+			if (!m_ByCommandID.Contains(anim.m_CommandID))
+				m_ByCommandID.Set(anim.m_CommandID, anim);
+			
+			array<ref SwarmTestAnimInfo> typeAnims;
+			if (!m_ByType.Find(anim.m_Type, typeAnims))
+			{
+				typeAnims = new array<ref SwarmTestAnimInfo>;
+				m_ByType.Set(anim.m_Type, typeAnims);
+			}
+			typeAnims.Insert(anim);
+			
+			m_ListText += anim.m_ListLine + "\n";
+		}
+		
+		m_SearchIndex = new SwarmTestAnimSearchIndex(m_All);
+		
+		Print("[SwarmTest] Animation registry built: " + m_All.Count() + " animations");
+	}
+	
+	// Get singleton instance
+	static SwarmTestAnimRegistry GetInstance()
+	{
+		if (!s_Instance)
+		{
+			s_Instance = new SwarmTestAnimRegistry();
+		}
+		return s_Instance;
+	}
+	
+	// All animations in table order (shared, do not modify)
+	array<ref SwarmTestAnimInfo> GetAll()
+	{
+		return m_All;
+	}
+	
+	// Animations of one type in table order (shared, do not modify; empty if none)
+	array<ref SwarmTestAnimInfo> GetByType(SwarmTestAnimType type)
+	{
+		array<ref SwarmTestAnimInfo> typeAnims;
+		if (!m_ByType.Find(type, typeAnims))
+		{
+			typeAnims = new array<ref SwarmTestAnimInfo>;
+			m_ByType.Set(type, typeAnims);
+		}
+		return typeAnims;
+	}
+	
+	// Find by name, ignoring case (null if unknown)
+	SwarmTestAnimInfo FindByName(string name)
+	{
+		name.ToLower();
+		
+		SwarmTestAnimInfo anim;
+		if (!m_ByName.Find(name, anim))
+			return null;
+		
+		return anim;
+	}
+	
+	// Find by command ID (null if unknown)
+	SwarmTestAnimInfo FindByCommandID(int commandID)
+	{
+		SwarmTestAnimInfo anim;
+		if (!m_ByCommandID.Find(commandID, anim))
+			return null;
+		
+		return anim;
+	}
+	
+	// Append the animations whose name or description contains term (lowercase) to results
+	void Search(string term, array<ref SwarmTestAnimInfo> results)
+	{
+		m_SearchIndex.Search(term, m_All, results);
+	}
+	
+	// "/anim list" output for every animation
+	string GetListText()
+	{
+		return m_ListText;
+	}
+}
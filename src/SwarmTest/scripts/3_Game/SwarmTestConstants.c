@@ -6,6 +6,11 @@ enum JMSwarmTestModuleRPC
 	PlayAnimationClient, // Server -> Client: execute animation locally
 	StopAnimation,
 	StopAnimationClient, // Server -> Client: stop animation locally
+	PlayAnimationGroupClient, // Server -> All clients: targets start a synced animation at a server time
+	SyncClock,           // Client -> Server: clock sync request
+	SyncClockClient,     // Server -> Client: clock sync reply
+	PlayTimeline,        // Client -> Server: play a timeline with the selected players as actors
+	StopTimeline,        // Client -> Server: stop the timeline
 	COUNT
 }
 
@@ -29,6 +34,12 @@ class SwarmTestAnimInfo
 	SwarmTestAnimType m_Type;
 	int m_StanceMask; // For full body actions
 	
+	// Precomputed for lookups and display
+	string m_LowerName;
+	string m_LowerDescription;
+	string m_DisplayName; // "[TYPE] Name"
+	string m_ListLine;    // "[TYPE] Name - Description"
+	
 	void SwarmTestAnimInfo(string name, int commandID, string description, SwarmTestAnimType type, int stanceMask = -1)
 	{
 		m_Name = name;
@@ -42,6 +53,15 @@ class SwarmTestAnimInfo
 		{
 			m_StanceMask = DayZPlayerConstants.STANCEMASK_CROUCH | DayZPlayerConstants.STANCEMASK_ERECT;
 		}
+		
+		// ToLower works in place, on copies
+		m_LowerName = name;
+		m_LowerName.ToLower();
+		m_LowerDescription = description;
+		m_LowerDescription.ToLower();
+		
+		m_DisplayName = "[" + GetTypeName() + "] " + name;
+		m_ListLine = m_DisplayName + " - " + description;
 	}
 	
 	string GetTypeName()
@@ -62,7 +82,37 @@ class SwarmTestAnimInfo
 // SwarmTest Constants - All animations from DayZPlayerConstants
 class SwarmTestConstants
 {
-	static ref array<ref SwarmTestAnimInfo> GetAllAnimations()
+	// Synced group playback: lead time between sending the command and the shared start, which must cover the
+	// trip to every target, and how often clients measure their offset to the server clock
+	static const int GROUP_START_DELAY_MS = 750;
+	static const int CLOCK_SYNC_FIRST_MS = 5000;
+	static const int CLOCK_SYNC_INTERVAL_MS = 60000;
+	static const int CLOCK_SYNC_WINDOW = 5; // Recent samples the offset is picked from, so drift is followed
+	
+	// Timelines: $profile:SwarmTest\timelines\<name>.json, played by one server timer
+	static const string DIR_SWARM_TEST = "$profile:SwarmTest\\";
+	static const string DIR_TIMELINES = DIR_SWARM_TEST + "timelines\\";
+	static const int TIMELINE_TICK_MS = 50;
+	
+	// Coverage runner (-swarmTestCoverage[=filter], -swarmTestCoverageExit): results in coverage_<time>.csv
+	static const string CLI_COVERAGE = "swarmTestCoverage";
+	static const string CLI_COVERAGE_EXIT = "swarmTestCoverageExit";
+	static const string FILE_COVERAGE_PREFIX = DIR_SWARM_TEST + "coverage_";
+	static const string COVERAGE_PLAYER_TYPE = "SurvivorM_Mirek";
+	static const vector COVERAGE_POSITION = "6000 0 6000";
+	static const int COVERAGE_TICK_MS = 50;
+	static const int COVERAGE_SETTLE_MS = 1500; // Stance change before each case
+	static const int COVERAGE_START_TIMEOUT_MS = 10000; // To the loop state or finish
+	static const int COVERAGE_CANCEL_TIMEOUT_MS = 5000;
+	
+	// All animations (shared registry array, built once)
+	static array<ref SwarmTestAnimInfo> GetAllAnimations()
+	{
+		return SwarmTestAnimRegistry.GetInstance().GetAll();
+	}
+	
+	// Build the animation table (only called once, by SwarmTestAnimRegistry)
+	static array<ref SwarmTestAnimInfo> CreateAnimationTable()
 	{
 		array<ref SwarmTestAnimInfo> anims = new array<ref SwarmTestAnimInfo>;
 		
@@ -287,18 +337,9 @@ class SwarmTestConstants
 		return anims;
 	}
 	
-	// Get animations filtered by type
-	static ref array<ref SwarmTestAnimInfo> GetAnimationsByType(SwarmTestAnimType type)
+	// Get animations filtered by type (shared registry array)
+	static array<ref SwarmTestAnimInfo> GetAnimationsByType(SwarmTestAnimType type)
 	{
-		array<ref SwarmTestAnimInfo> result = new array<ref SwarmTestAnimInfo>;
-		array<ref SwarmTestAnimInfo> all = GetAllAnimations();
-		
-		foreach (SwarmTestAnimInfo anim : all)
-		{
-			if (anim.m_Type == type)
-				result.Insert(anim);
-		}
-		
-		return result;
+		return SwarmTestAnimRegistry.GetInstance().GetByType(type);
 	}
 }
@@ -0,0 +1,181 @@
+// Animation timeline (choreography) - one JSON file per scene under $profile:SwarmTest\timelines\
+// Each track is one actor: a list of (time offset, animation, stance) events. "stop" as the animation ends
+// whatever the actor is playing. Stance is optional, a comma separated list of erect, crouch, prone,
+// raisederect, raisedcrouch and raisedprone, and overrides the animation's default stance mask.
+class SwarmTestTimelineEvent
+{
+	float Time; // Seconds from the start of the scene
+	string Animation;
+	string Stance;
+}
+
+class SwarmTestTimelineTrack
+{
+	string Actor; // Label for logs
+	string Player; // Steam ID or name to bind to; empty tracks take the selected players in order
+	autoptr array<ref SwarmTestTimelineEvent> Events;
+	
+	void SwarmTestTimelineTrack()
+	{
+		Events = new array<ref SwarmTestTimelineEvent>;
+	}
+}
+
+class SwarmTestTimelineData
+{
+	autoptr array<ref SwarmTestTimelineTrack> Tracks;
+	
+	void SwarmTestTimelineData()
+	{
+		Tracks = new array<ref SwarmTestTimelineTrack>;
+	}
+}
+
+// One compiled event: animation resolved to its registry entry (null means stop)
+class SwarmTestTimelineCue
+{
+	int m_TimeMs;
+	int m_Track;
+	ref SwarmTestAnimInfo m_Anim;
+	
+	void SwarmTestTimelineCue(int timeMs, int track, SwarmTestAnimInfo anim)
+	{
+		m_TimeMs = timeMs;
+		m_Track = track;
+		m_Anim = anim;
+	}
+}
+
+// A timeline compiled ahead of time: every track's events merged into one list sorted by time, so the
+// scheduler only ever looks at the next cue
+class SwarmTestCompiledTimeline
+{
+	string m_Name;
+	protected ref SwarmTestTimelineData m_Data;
+	array<ref SwarmTestTimelineTrack> m_Tracks; // Owned by m_Data
+	ref array<ref SwarmTestTimelineCue> m_Cues;
+	int m_DurationMs;
+	
+	void SwarmTestCompiledTimeline(string name)
+	{
+		m_Name = name;
+		m_Cues = new array<ref SwarmTestTimelineCue>;
+	}
+	
+	// Load and compile $profile:SwarmTest\timelines\<name>.json (null, with the reason logged, if it fails)
+	// The name comes from an admin's client, so it may only name a file inside the timelines folder
+	static SwarmTestCompiledTimeline Load(string name)
+	{
+		if (name == "" || name.Contains("/") || name.Contains("\\") || name.Contains(".."))
+		{
+			Print("[SwarmTest] Timeline name rejected: " + name);
+			return null;
+		}
+		
+		string path = SwarmTestConstants.DIR_TIMELINES + name + ".json";
+		if (!FileExist(path))
+		{
+			Print("[SwarmTest] Timeline not found: " + path);
+			return null;
+		}
+		
+		SwarmTestTimelineData data = new SwarmTestTimelineData();
+		JsonFileLoader<SwarmTestTimelineData>.JsonLoadFile(path, data);
+		
+		SwarmTestCompiledTimeline timeline = new SwarmTestCompiledTimeline(name);
+		if (!timeline.Compile(data))
+			return null;
+		
+		Print("[SwarmTest] Timeline '" + name + "' compiled: " + timeline.m_Tracks.Count() + " tracks, " + timeline.m_Cues.Count() + " cues, " + (timeline.m_DurationMs / 1000.0) + "s");
+		return timeline;
+	}
+	
+	protected bool Compile(SwarmTestTimelineData data)
+	{
+		m_Data = data;
+		m_Tracks = data.Tracks;
+		if (m_Tracks.Count() == 0)
+		{
+			Print("[SwarmTest] Timeline '" + m_Name + "' has no tracks");
+			return false;
+		}
+		
+		SwarmTestAnimRegistry registry = SwarmTestAnimRegistry.GetInstance();
+		for (int t = 0; t < m_Tracks.Count(); t++)
+		{
+			SwarmTestTimelineTrack track = m_Tracks[t];
+			if (track.Actor == "")
+				track.Actor = "Track " + (t + 1);
+			
+			foreach (SwarmTestTimelineEvent ev : track.Events)
+			{
+				string animName = ev.Animation;
+				animName.ToLower();
+				
+				SwarmTestAnimInfo anim = null;
+				if (animName != "stop")
+				{
+					anim = registry.FindByName(animName);
+					if (!anim)
+					{
+						Print("[SwarmTest] Timeline '" + m_Name + "', " + track.Actor + ": unknown animation '" + ev.Animation + "'");
+						return false;
+					}
+					
+					if (ev.Stance != "")
+					{
+						int stanceMask = ParseStanceMask(ev.Stance);
+						if (stanceMask == 0)
+						{
+							Print("[SwarmTest] Timeline '" + m_Name + "', " + track.Actor + ": unknown stance '" + ev.Stance + "'");
+							return false;
+						}
+						anim = new SwarmTestAnimInfo(anim.m_Name, anim.m_CommandID, anim.m_Description, anim.m_Type, stanceMask);
+					}
+				}
+				
+				int timeMs = Math.Max(0, ev.Time * 1000);
+				InsertCue(new SwarmTestTimelineCue(timeMs, t, anim));
+				m_DurationMs = Math.Max(m_DurationMs, timeMs);
+			}
+		}
+		
+		return true;
+	}
+	
+	// Insert after every cue with the same or an earlier time, so events at one instant keep file order
+	protected void InsertCue(SwarmTestTimelineCue cue)
+	{
+		int index = m_Cues.Count();
+		while (index > 0 && m_Cues[index - 1].m_TimeMs > cue.m_TimeMs)
+		{
+			index--;
+		}
+		m_Cues.InsertAt(cue, index);
+	}
+	
+	// "erect,crouch" -> stance mask (0 if any name is unknown)
+	static int ParseStanceMask(string stance)
+	{
+		array<string> names = new array<string>;
+		stance.ToLower();
+		stance.Split(",", names);
+		
+		int mask = 0;
+		foreach (string name : names)
+		{
+			name = name.Trim();
+			switch (name)
+			{
+				case "erect": mask |= DayZPlayerConstants.STANCEMASK_ERECT; break;
+				case "crouch": mask |= DayZPlayerConstants.STANCEMASK_CROUCH; break;
+				case "prone": mask |= DayZPlayerConstants.STANCEMASK_PRONE; break;
+				case "raisederect": mask |= DayZPlayerConstants.STANCEMASK_RAISEDERECT; break;
+				case "raisedcrouch": mask |= DayZPlayerConstants.STANCEMASK_RAISEDCROUCH; break;
+				case "raisedprone": mask |= DayZPlayerConstants.STANCEMASK_RAISEDPRONE; break;
+				default: return 0;
+			}
+		}
+		return mask;
+	}
+}
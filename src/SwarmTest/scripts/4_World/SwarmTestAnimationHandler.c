@@ -1,16 +1,53 @@
+// Start-to-loop and start-to-finish times of one action, filled in by its callback
+// Kept outside the callback so the numbers survive once the engine releases it (used by the coverage runner)
+class SwarmTestActionTiming
+{
+	int m_StartTime;
+	int m_LoopTime; // First loop state, 0 if the action never looped
+	int m_FinishTime; // 0 while running
+	bool m_Canceled;
+	
+	void SwarmTestActionTiming()
+	{
+		m_StartTime = GetGame().GetTime();
+	}
+}
+
 // SwarmTest Action Callback - Used for playing CMD_ACTION animations
 class SwarmTestActionCallback extends HumanCommandActionCallback
 {
+	// Timing for the next callbacks created (set around a play call, null otherwise)
+	static ref SwarmTestActionTiming s_NextTiming;
+	
+	protected ref SwarmTestActionTiming m_Timing;
+	
 	void SwarmTestActionCallback()
 	{
 		// Enable cancel condition so we can stop the animation
 		EnableCancelCondition(true);
 		// Enable state change callback for debugging
 		EnableStateChangeCallback();
+		
+		m_Timing = s_NextTiming;
+	}
+	
+	override void OnStateChange(int pOldState, int pCurrentState)
+	{
+		if (!m_Timing || m_Timing.m_LoopTime != 0)
+			return;
+		
+		if (pCurrentState == STATE_LOOP_LOOP || pCurrentState == STATE_LOOP_LOOP2)
+			m_Timing.m_LoopTime = GetGame().GetTime();
 	}
 	
 	override void OnFinish(bool pCanceled)
 	{
+		if (m_Timing && m_Timing.m_FinishTime == 0)
+		{
+			m_Timing.m_FinishTime = GetGame().GetTime();
+			m_Timing.m_Canceled = pCanceled;
+		}
+		
 		if (pCanceled)
 		{
 			Print("[SwarmTest] Action canceled");
@@ -54,15 +91,15 @@ class SwarmTestAnimationHandler
 		}
 	}
 	
-	// Play animation based on type
-	static void PlayAnimationEx(PlayerBase player, SwarmTestAnimInfo animInfo)
+	// Play animation based on type, returns the started action's callback (null if nothing started)
+	static HumanCommandActionCallback PlayAnimationEx(PlayerBase player, SwarmTestAnimInfo animInfo)
 	{
 		Print("[SwarmTest] PlayAnimationEx - player: " + player + ", name: " + animInfo.m_Name + ", type: " + animInfo.GetTypeName() + ", commandID: " + animInfo.m_CommandID);
 		
 		if (!player)
 		{
 			Print("[SwarmTest] PlayAnimationEx - player is null!");
-			return;
+			return null;
 		}
 		
 		// Auto-cancel for non-emote types only
@@ -75,24 +112,23 @@ class SwarmTestAnimationHandler
 		switch (animInfo.m_Type)
 		{
 			case SwarmTestAnimType.EMOTE:
-				PlayEmote(player, animInfo.m_CommandID);
-				break;
+				return PlayEmote(player, animInfo.m_CommandID);
 				
 			case SwarmTestAnimType.ACTIONMOD:
 			case SwarmTestAnimType.GESTUREMOD:
-				PlayModifierAction(player, animInfo.m_CommandID);
-				break;
+				return PlayModifierAction(player, animInfo.m_CommandID);
 				
 			case SwarmTestAnimType.ACTIONFB:
 			case SwarmTestAnimType.GESTUREFB:
 			case SwarmTestAnimType.SUICIDEFB:
-				PlayFullBodyAction(player, animInfo.m_CommandID, animInfo.m_StanceMask);
-				break;
+				return PlayFullBodyAction(player, animInfo.m_CommandID, animInfo.m_StanceMask);
 		}
+		
+		return null;
 	}
 	
 	// Play emote by looking up the command ID and playing directly
-	static void PlayEmote(PlayerBase player, int emoteID)
+	static HumanCommandActionCallback PlayEmote(PlayerBase player, int emoteID)
 	{
 		Print("[SwarmTest] PlayEmote - emoteID: " + emoteID);
 		
@@ -100,7 +136,7 @@ class SwarmTestAnimationHandler
 		if (!emoteManager)
 		{
 			Print("[SwarmTest] EmoteManager is null!");
-			return;
+			return null;
 		}
 		
 		// Get the name-to-emote map
@@ -108,7 +144,7 @@ class SwarmTestAnimationHandler
 		if (!emoteMap)
 		{
 			Print("[SwarmTest] EmoteMap is null!");
-			return;
+			return null;
 		}
 		
 		// Find the emote
@@ -116,7 +152,7 @@ class SwarmTestAnimationHandler
 		if (!emote)
 		{
 			Print("[SwarmTest] Emote not found for ID: " + emoteID);
-			return;
+			return null;
 		}
 		
 		// Set owner player on the emote
@@ -136,23 +172,25 @@ class SwarmTestAnimationHandler
 		if (fullbodyUID != 0)
 		{
 			Print("[SwarmTest] Playing fullbody emote: " + fullbodyUID);
-			dzPlayer.StartCommand_Action(fullbodyUID, SwarmTestActionCallback, fullbodyMask);
+			return dzPlayer.StartCommand_Action(fullbodyUID, SwarmTestActionCallback, fullbodyMask);
 		}
 		// Fallback to additive only if no fullbody available
 		else if (additiveUID != 0)
 		{
 			Print("[SwarmTest] Playing additive emote (no fullbody available): " + additiveUID);
-			dzPlayer.AddCommandModifier_Action(additiveUID, SwarmTestActionCallback);
+			return dzPlayer.AddCommandModifier_Action(additiveUID, SwarmTestActionCallback);
 		}
 		else
 		{
 			Print("[SwarmTest] No valid animation UID found for emote: " + emoteID);
 		}
+		
+		return null;
 	}
 	
 	// Play modifier action using AddCommandModifier_Action
 	// Note: Modifier actions are additive and may not work in all player states
-	static void PlayModifierAction(PlayerBase player, int commandID)
+	static HumanCommandActionCallback PlayModifierAction(PlayerBase player, int commandID)
 	{
 		Print("[SwarmTest] PlayModifierAction - commandID: " + commandID);
 		
@@ -160,7 +198,7 @@ class SwarmTestAnimationHandler
 		if (!dzPlayer)
 		{
 			Print("[SwarmTest] Failed to get DayZPlayer!");
-			return;
+			return null;
 		}
 		
 		// First try as modifier (additive animation)
@@ -168,7 +206,7 @@ class SwarmTestAnimationHandler
 		if (callback)
 		{
 			Print("[SwarmTest] Modifier action started successfully");
-			return;
+			return callback;
 		}
 		
 		Print("[SwarmTest] Modifier action failed, trying as fullbody with ERECT stance");
@@ -182,10 +220,12 @@ class SwarmTestAnimationHandler
 		{
 			Print("[SwarmTest] Both modifier and fullbody attempts failed for commandID: " + commandID);
 		}
+		
+		return callback;
 	}
 	
 	// Play full body action using StartCommand_Action
-	static void PlayFullBodyAction(PlayerBase player, int commandID, int stanceMask)
+	static HumanCommandActionCallback PlayFullBodyAction(PlayerBase player, int commandID, int stanceMask)
 	{
 		Print("[SwarmTest] PlayFullBodyAction - commandID: " + commandID + ", stanceMask: " + stanceMask);
 		
@@ -202,11 +242,14 @@ class SwarmTestAnimationHandler
 			{
 				Print("[SwarmTest] Failed to start full body action - returned null callback");
 			}
+			return callback;
 		}
 		else
 		{
 			Print("[SwarmTest] Failed to cast to DayZPlayer!");
 		}
+		
+		return null;
 	}
 	
 	// Legacy method for backwards compatibility
@@ -215,14 +258,11 @@ class SwarmTestAnimationHandler
 		Print("[SwarmTest] Legacy PlayAnimation called - commandID: " + commandID);
 		
 		// Try to find the animation info for this command
-		array<ref SwarmTestAnimInfo> anims = SwarmTestConstants.GetAllAnimations();
-		foreach (SwarmTestAnimInfo anim : anims)
+		SwarmTestAnimInfo anim = SwarmTestAnimRegistry.GetInstance().FindByCommandID(commandID);
+		if (anim)
 		{
-			if (anim.m_CommandID == commandID)
-			{
-				PlayAnimationEx(player, anim);
-				return;
-			}
+			PlayAnimationEx(player, anim);
+			return;
 		}
 		
 		// Fallback: try as emote
@@ -230,6 +270,57 @@ class SwarmTestAnimationHandler
 		PlayEmote(player, commandID);
 	}
 	
+	// Play on the machine that owns the player, like the COT panel does: directly for the host's own player (listen
+	// server or offline), otherwise forwarded to the player's client. Returns false if the player has no identity.
+	static bool PlayAnimationOnOwner(PlayerBase player, SwarmTestAnimInfo animInfo)
+	{
+		if (!player)
+			return false;
+		
+		if (player == GetGame().GetPlayer())
+		{
+			PlayAnimationEx(player, animInfo);
+			return true;
+		}
+		
+		PlayerIdentity identity = player.GetIdentity();
+		if (!identity)
+		{
+			Print("[SwarmTest] Target player has no identity, skipping");
+			return false;
+		}
+		
+		Print("[SwarmTest] Server forwarding animation to client: commandID=" + animInfo.m_CommandID + ", type=" + animInfo.m_Type + ", stanceMask=" + animInfo.m_StanceMask);
+		
+		ScriptRPC rpc = new ScriptRPC();
+		rpc.Write(animInfo.m_CommandID);
+		rpc.Write(animInfo.m_Type);
+		rpc.Write(animInfo.m_StanceMask);
+		rpc.Send(player, JMSwarmTestModuleRPC.PlayAnimationClient, true, identity);
+		return true;
+	}
+	
+	// Stop on the machine that owns the player (see PlayAnimationOnOwner)
+	static bool EndAnimationOnOwner(PlayerBase player)
+	{
+		if (!player)
+			return false;
+		
+		if (player == GetGame().GetPlayer())
+		{
+			EndCurrentAnimation(player);
+			return true;
+		}
+		
+		PlayerIdentity identity = player.GetIdentity();
+		if (!identity)
+			return false;
+		
+		ScriptRPC rpc = new ScriptRPC();
+		rpc.Send(player, JMSwarmTestModuleRPC.StopAnimationClient, true, identity);
+		return true;
+	}
+	
 	static void EndCurrentAnimation(PlayerBase player)
 	{
 		Print("[SwarmTest] EndCurrentAnimation called");
@@ -292,14 +383,17 @@ class SwarmTestAnimationHandler
 		return help;
 	}
 	
+	// category is a SwarmTestAnimType, -1 lists everything
 	static string ListAnimations(int category = -1)
 	{
-		string result = "=== Available Animations ===\n";
-		array<ref SwarmTestAnimInfo> anims = SwarmTestConstants.GetAllAnimations();
+		SwarmTestAnimRegistry registry = SwarmTestAnimRegistry.GetInstance();
+		if (category == -1)
+			return registry.GetListText();
 		
-		foreach (SwarmTestAnimInfo anim : anims)
+		string result = "=== Available Animations ===\n";
+		foreach (SwarmTestAnimInfo anim : registry.GetByType(category))
 		{
-			result += "[" + anim.GetTypeName() + "] " + anim.m_Name + " - " + anim.m_Description + "\n";
+			result += anim.m_ListLine + "\n";
 		}
 		
 		return result;
@@ -307,17 +401,11 @@ class SwarmTestAnimationHandler
 	
 	static bool FindAndPlayAnimation(PlayerBase player, string animName)
 	{
-		array<ref SwarmTestAnimInfo> anims = SwarmTestConstants.GetAllAnimations();
-		
-		foreach (SwarmTestAnimInfo anim : anims)
-		{
-			if (anim.m_Name.ToLower() == animName.ToLower())
-			{
-				PlayAnimationEx(player, anim);
-				return true;
-			}
-		}
+		SwarmTestAnimInfo anim = SwarmTestAnimRegistry.GetInstance().FindByName(animName);
+		if (!anim)
+			return false;
 		
-		return false;
+		PlayAnimationEx(player, anim);
+		return true;
 	}
 }
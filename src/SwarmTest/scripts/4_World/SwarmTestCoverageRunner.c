@@ -0,0 +1,326 @@
+// Coverage runner phases, per animation and stance
+enum SwarmTestCoveragePhase
+{
+	SPAWN,
+	STANCE,   // Stance forced, waiting for it to settle
+	PLAYING,  // Waiting for the loop state or the finish
+	CANCELING // Cancel requested, waiting for the finish
+}
+
+// One animation in one stance
+class SwarmTestCoverageCase
+{
+	SwarmTestAnimInfo m_Anim;
+	int m_StanceIdx;
+	
+	void SwarmTestCoverageCase(SwarmTestAnimInfo anim, int stanceIdx)
+	{
+		m_Anim = anim;
+		m_StanceIdx = stanceIdx;
+	}
+}
+
+// Animation coverage runner
+// Started on a dedicated server with -swarmTestCoverage[=filter] (filter: part of an animation name), it spawns one
+// dummy player and plays every registered animation in every stance it allows (erect, crouch and prone from the
+// stance mask for full body types, all three for the others) through SwarmTestAnimationHandler.PlayAnimationEx.
+// For each case it records whether a callback came back and on which path, the time to the loop state or finish,
+// whether a cancel finished it, and the total duration, into $profile:SwarmTest\coverage_<time>.csv.
+// -swarmTestCoverageExit shuts the server down once the report is written.
+class SwarmTestCoverageRunner
+{
+	private static ref SwarmTestCoverageRunner s_Instance;
+	
+	protected ref array<ref SwarmTestCoverageCase> m_Cases;
+	protected int m_CaseIndex;
+	protected int m_Phase;
+	protected int m_PhaseStartTime;
+	protected bool m_ExitWhenDone;
+	
+	protected PlayerBase m_Player;
+	protected FileHandle m_File;
+	protected string m_Path;
+	
+	// Current case
+	protected ref SwarmTestActionTiming m_Timing;
+	protected HumanCommandActionCallback m_Callback; // Engine owned, gone once the action ends
+	protected bool m_Started;
+	protected string m_StartPath;
+	protected int m_CancelTime;
+	protected int m_Failures;
+	
+	void SwarmTestCoverageRunner(string filter, bool exitWhenDone)
+	{
+		m_Cases = new array<ref SwarmTestCoverageCase>;
+		m_ExitWhenDone = exitWhenDone;
+		filter.ToLower();
+		
+		foreach (SwarmTestAnimInfo anim : SwarmTestAnimRegistry.GetInstance().GetAll())
+		{
+			if (filter != "" && !anim.m_LowerName.Contains(filter))
+				continue;
+			
+			AddCases(anim);
+		}
+	}
+	
+	protected void AddCases(SwarmTestAnimInfo anim)
+	{
+		bool fullBody = anim.m_Type == SwarmTestAnimType.ACTIONFB || anim.m_Type == SwarmTestAnimType.GESTUREFB || anim.m_Type == SwarmTestAnimType.SUICIDEFB;
+		
+		if (!fullBody || (anim.m_StanceMask & DayZPlayerConstants.STANCEMASK_ERECT))
+			m_Cases.Insert(new SwarmTestCoverageCase(anim, DayZPlayerConstants.STANCEIDX_ERECT));
+		if (!fullBody || (anim.m_StanceMask & DayZPlayerConstants.STANCEMASK_CROUCH))
+			m_Cases.Insert(new SwarmTestCoverageCase(anim, DayZPlayerConstants.STANCEIDX_CROUCH));
+		if (!fullBody || (anim.m_StanceMask & DayZPlayerConstants.STANCEMASK_PRONE))
+			m_Cases.Insert(new SwarmTestCoverageCase(anim, DayZPlayerConstants.STANCEIDX_PRONE));
+	}
+	
+	// Start the run if it was requested (called from MissionServer.OnInit)
+	static void Start()
+	{
+		if (!GetGame().IsDedicatedServer() || s_Instance)
+			return;
+		
+		string filter;
+		if (!GetCLIParam(SwarmTestConstants.CLI_COVERAGE, filter))
+			return;
+		
+		string unused;
+		bool exitWhenDone = GetCLIParam(SwarmTestConstants.CLI_COVERAGE_EXIT, unused);
+		
+		s_Instance = new SwarmTestCoverageRunner(filter, exitWhenDone);
+		s_Instance.m_Path = SwarmTestConstants.FILE_COVERAGE_PREFIX + GetReportStamp() + ".csv";
+		s_Instance.m_File = OpenFile(s_Instance.m_Path, FileMode.WRITE);
+		if (s_Instance.m_File == 0)
+		{
+			Print("[SwarmTest] Failed to write coverage results: " + s_Instance.m_Path);
+			s_Instance.Finish();
+			return;
+		}
+		
+		FPrintln(s_Instance.m_File, "name,type,command_id,stance,actual_stance,started,path,loop_ms,finish_ms,canceled,cancel_ms,total_ms,result");
+		
+		Print("[SwarmTest] Coverage run started: " + s_Instance.m_Cases.Count() + " cases");
+		s_Instance.m_Phase = SwarmTestCoveragePhase.SPAWN;
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(s_Instance.Tick, SwarmTestConstants.COVERAGE_TICK_MS, true);
+	}
+	
+	// Advance the current case (called by timer)
+	void Tick()
+	{
+		int elapsed = GetGame().GetTime() - m_PhaseStartTime;
+		
+		switch (m_Phase)
+		{
+			case SwarmTestCoveragePhase.SPAWN:
+				if (!Spawn())
+					return;
+				BeginCase();
+				break;
+			
+			case SwarmTestCoveragePhase.STANCE:
+				if (elapsed >= SwarmTestConstants.COVERAGE_SETTLE_MS)
+					StartAnimation();
+				break;
+			
+			case SwarmTestCoveragePhase.PLAYING:
+				if (m_Timing.m_FinishTime != 0)
+				{
+					EndCase();
+				}
+				else if (m_Timing.m_LoopTime != 0 || elapsed >= SwarmTestConstants.COVERAGE_START_TIMEOUT_MS)
+				{
+					// Looping animations (and ones that never report a state) are canceled to test the way out
+					m_CancelTime = GetGame().GetTime();
+					if (m_Callback)
+						m_Callback.Cancel();
+					SetPhase(SwarmTestCoveragePhase.CANCELING);
+				}
+				break;
+			
+			case SwarmTestCoveragePhase.CANCELING:
+				if (m_Timing.m_FinishTime != 0 || elapsed >= SwarmTestConstants.COVERAGE_CANCEL_TIMEOUT_MS)
+					EndCase();
+				break;
+		}
+	}
+	
+	protected void SetPhase(int phase)
+	{
+		m_Phase = phase;
+		m_PhaseStartTime = GetGame().GetTime();
+	}
+	
+	// Spawn (or respawn, if a suicide animation killed it) the test player
+	protected bool Spawn()
+	{
+		if (m_Player && m_Player.IsAlive())
+			return true;
+		
+		vector position = SwarmTestConstants.COVERAGE_POSITION;
+		position[1] = GetGame().SurfaceY(position[0], position[2]);
+		
+		m_Player = PlayerBase.Cast(GetGame().CreatePlayer(null, SwarmTestConstants.COVERAGE_PLAYER_TYPE, position, 0, "NONE"));
+		if (!m_Player)
+		{
+			Print("[SwarmTest] Coverage run aborted: failed to spawn " + SwarmTestConstants.COVERAGE_PLAYER_TYPE);
+			Finish();
+			return false;
+		}
+		return true;
+	}
+	
+	// Force the next case's stance and let it settle
+	protected void BeginCase()
+	{
+		if (m_CaseIndex >= m_Cases.Count())
+		{
+			Finish();
+			return;
+		}
+		
+		if (!m_Player || !m_Player.IsAlive())
+		{
+			SetPhase(SwarmTestCoveragePhase.SPAWN);
+			return;
+		}
+		
+		HumanCommandMove move = m_Player.GetCommand_Move();
+		if (move)
+			move.ForceStance(m_Cases[m_CaseIndex].m_StanceIdx);
+		
+		SetPhase(SwarmTestCoveragePhase.STANCE);
+	}
+	
+	protected void StartAnimation()
+	{
+		SwarmTestCoverageCase testCase = m_Cases[m_CaseIndex];
+		
+		m_Timing = new SwarmTestActionTiming();
+		m_CancelTime = 0;
+		
+		SwarmTestActionCallback.s_NextTiming = m_Timing;
+		m_Callback = SwarmTestAnimationHandler.PlayAnimationEx(m_Player, testCase.m_Anim);
+		SwarmTestActionCallback.s_NextTiming = null;
+		m_Started = m_Callback != null;
+		
+		m_StartPath = "none";
+		if (m_Callback && m_Callback == m_Player.GetCommandModifier_Action())
+			m_StartPath = "modifier";
+		else if (m_Callback)
+			m_StartPath = "fullbody";
+		
+		if (!m_Started)
+		{
+			EndCase();
+			return;
+		}
+		
+		SetPhase(SwarmTestCoveragePhase.PLAYING);
+	}
+	
+	// Write the case's row and move on
+	protected void EndCase()
+	{
+		SwarmTestCoverageCase testCase = m_Cases[m_CaseIndex];
+		SwarmTestAnimInfo anim = testCase.m_Anim;
+		
+		HumanMovementState state = new HumanMovementState();
+		m_Player.GetMovementState(state);
+		
+		int loopMs = -1;
+		if (m_Timing.m_LoopTime != 0)
+			loopMs = m_Timing.m_LoopTime - m_Timing.m_StartTime;
+		
+		// finish_ms is a finish on its own, total_ms also counts one brought on by the cancel
+		int totalMs = -1;
+		if (m_Timing.m_FinishTime != 0)
+			totalMs = m_Timing.m_FinishTime - m_Timing.m_StartTime;
+		
+		int finishMs = -1;
+		if (m_CancelTime == 0)
+			finishMs = totalMs;
+		
+		int cancelMs = -1;
+		if (m_CancelTime != 0 && m_Timing.m_FinishTime != 0)
+			cancelMs = m_Timing.m_FinishTime - m_CancelTime;
+		
+		string result = GetResult(loopMs);
+		if (result != "ok")
+			m_Failures++;
+		
+		FPrintln(m_File, string.Format("%1,%2,%3,%4,%5,%6,%7,%8,%9", anim.m_Name, anim.GetTypeName(), anim.m_CommandID, GetStanceName(testCase.m_StanceIdx), GetStanceName(state.m_iStanceIdx), m_Started, m_StartPath, loopMs, finishMs) + string.Format(",%1,%2,%3,%4", m_CancelTime != 0, cancelMs, totalMs, result));
+		
+		// Make sure nothing carries over into the next case
+		if (m_Timing.m_FinishTime == 0)
+			SwarmTestAnimationHandler.EndCurrentAnimation(m_Player);
+		
+		m_Callback = null;
+		m_CaseIndex++;
+		BeginCase();
+	}
+	
+	// ok, no_callback, canceled_by_engine (finished canceled on its own), cancel_ignored (still running after
+	// the cancel) or timeout (neither looped nor finished before the cancel)
+	protected string GetResult(int loopMs)
+	{
+		if (!m_Started)
+			return "no_callback";
+		
+		if (m_CancelTime == 0)
+		{
+			if (m_Timing.m_Canceled)
+				return "canceled_by_engine";
+			return "ok";
+		}
+		
+		if (m_Timing.m_FinishTime == 0)
+			return "cancel_ignored";
+		
+		if (loopMs == -1)
+			return "timeout";
+		
+		return "ok";
+	}
+	
+	protected void Finish()
+	{
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(Tick);
+		
+		if (m_File != 0)
+		{
+			CloseFile(m_File);
+			Print("[SwarmTest] Coverage results written to " + m_Path + " (" + m_Failures + "/" + m_CaseIndex + " cases flagged)");
+		}
+		
+		if (m_Player)
+			GetGame().ObjectDelete(m_Player);
+		
+		if (m_ExitWhenDone)
+			GetGame().RequestExit(0);
+	}
+	
+	static string GetStanceName(int stanceIdx)
+	{
+		switch (stanceIdx)
+		{
+			case DayZPlayerConstants.STANCEIDX_ERECT: return "erect";
+			case DayZPlayerConstants.STANCEIDX_CROUCH: return "crouch";
+			case DayZPlayerConstants.STANCEIDX_PRONE: return "prone";
+			case DayZPlayerConstants.STANCEIDX_RAISEDERECT: return "raisederect";
+			case DayZPlayerConstants.STANCEIDX_RAISEDCROUCH: return "raisedcrouch";
+			case DayZPlayerConstants.STANCEIDX_RAISEDPRONE: return "raisedprone";
+		}
+		return "?";
+	}
+	
+	// Local time as yyyymmdd_hhmmss, for report file names
+	static string GetReportStamp()
+	{
+		int year, month, day, hour, minute, second;
+		GetYearMonthDay(year, month, day);
+		GetHourMinuteSecond(hour, minute, second);
+		return year.ToString() + month.ToStringLen(2) + day.ToStringLen(2) + "_" + hour.ToStringLen(2) + minute.ToStringLen(2) + second.ToStringLen(2);
+	}
+}
@@ -0,0 +1,151 @@
+// Timeline scheduler - plays one compiled timeline at a time on the server
+// A single repeating timer walks the time-sorted cues and fires every one that is due, however many actors and events
+// the scene has. Cues go to the client that owns each actor, the same way the COT panel plays animations.
+class SwarmTestTimelinePlayer
+{
+	private static ref SwarmTestTimelinePlayer s_Instance;
+	
+	protected ref SwarmTestCompiledTimeline m_Timeline;
+	protected ref array<PlayerBase> m_Actors; // Indexed by track, null when the track is unbound
+	protected int m_StartTime;
+	protected int m_NextCue;
+	
+	void SwarmTestTimelinePlayer()
+	{
+		m_Actors = new array<PlayerBase>;
+	}
+	
+	// Get singleton instance
+	static SwarmTestTimelinePlayer GetInstance()
+	{
+		if (!s_Instance)
+		{
+			s_Instance = new SwarmTestTimelinePlayer();
+		}
+		return s_Instance;
+	}
+	
+	bool IsPlaying()
+	{
+		return m_Timeline != null;
+	}
+	
+	// Bind the tracks to players and start the scene, replacing any scene already playing
+	// Tracks naming a Player bind to that player if online, the others take the selected players in order.
+	bool Play(SwarmTestCompiledTimeline timeline, array<PlayerBase> selected)
+	{
+		Stop();
+		
+		array<Man> online = new array<Man>;
+		GetGame().GetPlayers(online);
+		
+		int nextSelected = 0;
+		int bound = 0;
+		m_Actors.Clear();
+		foreach (SwarmTestTimelineTrack track : timeline.m_Tracks)
+		{
+			PlayerBase actor = null;
+			if (track.Player != "")
+			{
+				actor = FindPlayer(online, track.Player);
+			}
+			else if (nextSelected < selected.Count())
+			{
+				actor = selected[nextSelected];
+				nextSelected++;
+			}
+			
+			if (actor)
+				bound++;
+			else
+				Print("[SwarmTest] Timeline '" + timeline.m_Name + "': no player for " + track.Actor + ", its events are skipped");
+			
+			m_Actors.Insert(actor);
+		}
+		
+		if (bound == 0)
+		{
+			Print("[SwarmTest] Timeline '" + timeline.m_Name + "' not started: no actors");
+			m_Actors.Clear();
+			return false;
+		}
+		
+		m_Timeline = timeline;
+		m_StartTime = GetGame().GetTime();
+		m_NextCue = 0;
+		
+		Print("[SwarmTest] Timeline '" + timeline.m_Name + "' started with " + bound + "/" + m_Actors.Count() + " actors");
+		
+		// Cues at time 0 fire now, the rest from the timer
+		Tick();
+		if (m_Timeline)
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(Tick, SwarmTestConstants.TIMELINE_TICK_MS, true);
+		
+		return true;
+	}
+	
+	// Stop the scene and end whatever the actors are playing
+	void Stop()
+	{
+		if (!m_Timeline)
+			return;
+		
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(Tick);
+		
+		foreach (PlayerBase actor : m_Actors)
+		{
+			if (actor && actor.IsAlive())
+				SwarmTestAnimationHandler.EndAnimationOnOwner(actor);
+		}
+		
+		Print("[SwarmTest] Timeline '" + m_Timeline.m_Name + "' stopped");
+		Finish();
+	}
+	
+	// Fire every due cue (called by timer)
+	protected void Tick()
+	{
+		int elapsed = GetGame().GetTime() - m_StartTime;
+		array<ref SwarmTestTimelineCue> cues = m_Timeline.m_Cues;
+		
+		while (m_NextCue < cues.Count() && cues[m_NextCue].m_TimeMs <= elapsed)
+		{
+			SwarmTestTimelineCue cue = cues[m_NextCue];
+			m_NextCue++;
+			
+			PlayerBase actor = m_Actors[cue.m_Track];
+			if (!actor || !actor.IsAlive())
+				continue;
+			
+			if (cue.m_Anim)
+				SwarmTestAnimationHandler.PlayAnimationOnOwner(actor, cue.m_Anim);
+			else
+				SwarmTestAnimationHandler.EndAnimationOnOwner(actor);
+		}
+		
+		if (m_NextCue >= cues.Count())
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(Tick);
+			Print("[SwarmTest] Timeline '" + m_Timeline.m_Name + "' finished");
+			Finish();
+		}
+	}
+	
+	protected void Finish()
+	{
+		m_Timeline = null;
+		m_Actors.Clear();
+	}
+	
+	// Online player by Steam ID or name (null if not found)
+	protected static PlayerBase FindPlayer(array<Man> online, string key)
+	{
+		foreach (Man man : online)
+		{
+			PlayerIdentity identity = man.GetIdentity();
+			if (identity && (identity.GetPlainId() == key || identity.GetName() == key))
+				return PlayerBase.Cast(man);
+		}
+		return null;
+	}
+}
@@ -19,9 +19,11 @@ class JMSwarmTestForm: JMFormBase
 	protected ref ScriptInvoker m_OnSearchChanged;
 	
 	protected Widget m_AnimationWrapper;
-	protected ref array<ref UIActionButton> m_AnimationButtons;
-	protected ref array<ref SwarmTestAnimInfo> m_AllAnimations;
+	protected ref array<ref UIActionButton> m_AnimationButtons; // One page of buttons, created once and reused
+	protected array<ref SwarmTestAnimInfo> m_AllAnimations; // Shared registry array
 	protected ref array<ref SwarmTestAnimInfo> m_FilteredAnimations;
+	protected ref array<ref SwarmTestAnimInfo> m_SearchScratch;
+	protected string m_LastSearchTerm;
 	
 	protected int m_CurrentPage = 0;
 	protected int m_AnimsPerPage = 20;
@@ -30,13 +32,16 @@ class JMSwarmTestForm: JMFormBase
 	protected UIActionButton m_NextPageButton;
 	protected UIActionText m_PageInfo;
 	protected UIActionButton m_StopButton;
+	protected UIActionCheckbox m_SyncedCheckbox;
+	protected UIActionEditableText m_TimelineName;
 	
 	protected JMSwarmTestModule m_Module;
 
 	void JMSwarmTestForm()
 	{
-		m_AllAnimations = SwarmTestConstants.GetAllAnimations();
+		m_AllAnimations = SwarmTestAnimRegistry.GetInstance().GetAll();
 		m_FilteredAnimations = new array<ref SwarmTestAnimInfo>;
+		m_SearchScratch = new array<ref SwarmTestAnimInfo>;
 		m_AnimationButtons = new array<ref UIActionButton>;
 		m_OnSearchChanged = new ScriptInvoker();
 		
@@ -56,8 +61,15 @@ class JMSwarmTestForm: JMFormBase
 		// Search box
 		m_SearchBox = UIActionManager.CreateEditableText(m_ActionsParent, "Search:", this, "OnChange_Search");
 		
-		// Animation wrapper - will hold the buttons
+		// Animation wrapper - holds a fixed pool of buttons, relabelled for each page
 		m_AnimationWrapper = UIActionManager.CreateActionRows(m_ActionsParent);
+		for (int i = 0; i < m_AnimsPerPage; i++)
+		{
+			UIActionButton btn = UIActionManager.CreateButton(m_AnimationWrapper, "", this, "OnClick_PlayAnimation");
+			btn.SetData(new SwarmTestAnimUIData(null));
+			btn.Hide();
+			m_AnimationButtons.Insert(btn);
+		}
 		
 		// Navigation
 		Widget navGrid = UIActionManager.CreateGridSpacer(m_ActionsParent, 1, 3);
@@ -65,16 +77,25 @@ class JMSwarmTestForm: JMFormBase
 		m_PageInfo = UIActionManager.CreateText(navGrid, "", "");
 		m_NextPageButton = UIActionManager.CreateButton(navGrid, "Next", this, "OnClick_NextPage");
 		
+		// Group playback: all selected players start together
+		m_SyncedCheckbox = UIActionManager.CreateCheckbox(m_ActionsParent, "Play In Sync (Group)", this, "", false);
+		
 		// Stop button
 		m_StopButton = UIActionManager.CreateButton(m_ActionsParent, "Stop Current Animation", this, "OnClick_StopAnimation");
 		
+		// Timeline - $profile:SwarmTest\timelines\<name>.json on the server
+		m_TimelineName = UIActionManager.CreateEditableText(m_ActionsParent, "Timeline:");
+		Widget timelineGrid = UIActionManager.CreateGridSpacer(m_ActionsParent, 1, 2);
+		UIActionManager.CreateButton(timelineGrid, "Play Timeline", this, "OnClick_PlayTimeline");
+		UIActionManager.CreateButton(timelineGrid, "Stop Timeline", this, "OnClick_StopTimeline");
+		
+		m_LastSearchTerm = "";
+		m_FilteredAnimations.Copy(m_AllAnimations);
 		RefreshAnimationList();
 	}
 
 	void RefreshAnimationList()
 	{
-		m_FilteredAnimations.Clear();
-		
 		string searchTerm = "";
 		if (m_SearchBox)
 		{
@@ -82,63 +103,71 @@ class JMSwarmTestForm: JMFormBase
 			searchTerm.ToLower();
 		}
 		
-		Print("[SwarmTest] Refreshing list - Search: " + searchTerm);
-		
-		// Filter animations
-		foreach (SwarmTestAnimInfo anim: m_AllAnimations)
+		if (searchTerm != m_LastSearchTerm)
 		{
-			// Filter by search term
-			if (searchTerm != "")
+			m_SearchScratch.Clear();
+			
+			if (searchTerm == "")
 			{
-				string animName = anim.m_Name;
-				animName.ToLower();
-				string animDesc = anim.m_Description;
-				animDesc.ToLower();
-				
-				if (!animName.Contains(searchTerm) && !animDesc.Contains(searchTerm))
-					continue;
+				m_SearchScratch.Copy(m_AllAnimations);
+			}
+			else if (m_LastSearchTerm != "" && searchTerm.IndexOf(m_LastSearchTerm) == 0)
+			{
+				// Typing on extends the last term, so only the current results can still match
+				SwarmTestAnimSearchIndex.Filter(searchTerm, m_FilteredAnimations, m_SearchScratch);
+			}
+			else
+			{
+				SwarmTestAnimRegistry.GetInstance().Search(searchTerm, m_SearchScratch);
 			}
 			
-			m_FilteredAnimations.Insert(anim);
+			// Swap so the next narrowing reads these results
+			array<ref SwarmTestAnimInfo> previous = m_FilteredAnimations;
+			m_FilteredAnimations = m_SearchScratch;
+			m_SearchScratch = previous;
+			m_SearchScratch.Clear();
+			m_LastSearchTerm = searchTerm;
 		}
 		
-		Print("[SwarmTest] Filtered: " + m_FilteredAnimations.Count() + " / " + m_AllAnimations.Count() + " animations");
-		
 		// Reset to first page if we have fewer results
-		int maxPages = Math.Ceil(m_FilteredAnimations.Count() / m_AnimsPerPage);
-		if (m_CurrentPage >= maxPages)
+		if (m_CurrentPage >= GetPageCount())
 			m_CurrentPage = 0;
 		
 		UpdateAnimationButtons();
 		UpdatePageInfo();
 	}
 	
+	// Number of pages in the current results (at least 1)
+	int GetPageCount()
+	{
+		return Math.Max(1, (m_FilteredAnimations.Count() + m_AnimsPerPage - 1) / m_AnimsPerPage);
+	}
+	
 	void UpdateAnimationButtons()
 	{
-		// Clear existing buttons by deleting children of wrapper
-		Widget child = m_AnimationWrapper.GetChildren();
-		while (child)
-		{
-			Widget next = child.GetSibling();
-			delete child;
-			child = next;
-		}
-		m_AnimationButtons.Clear();
-		
-		// Calculate visible range
 		int startIdx = m_CurrentPage * m_AnimsPerPage;
-		int endIdx = Math.Min(startIdx + m_AnimsPerPage, m_FilteredAnimations.Count());
 		
-		Print("[SwarmTest] Creating buttons from " + startIdx + " to " + endIdx + " (page " + m_CurrentPage + ")");
-		
-		// Create buttons for current page directly in wrapper
-		for (int i = startIdx; i < endIdx; i++)
+		// Relabel the pooled buttons in place, hiding the ones past the end of the results
+		for (int i = 0; i < m_AnimationButtons.Count(); i++)
 		{
-			SwarmTestAnimInfo anim = m_FilteredAnimations[i];
-			string buttonText = "[" + anim.GetTypeName() + "] " + anim.m_Name;
-			UIActionButton btn = UIActionManager.CreateButton(m_AnimationWrapper, buttonText, this, "OnClick_PlayAnimation");
-			btn.SetData(new SwarmTestAnimUIData(anim));
-			m_AnimationButtons.Insert(btn);
+			UIActionButton btn = m_AnimationButtons[i];
+			SwarmTestAnimUIData data = SwarmTestAnimUIData.Cast(btn.GetData());
+			
+			int animIdx = startIdx + i;
+			if (animIdx >= m_FilteredAnimations.Count())
+			{
+				data.AnimInfo = null;
+				btn.Hide();
+				continue;
+			}
+			
+			SwarmTestAnimInfo anim = m_FilteredAnimations[animIdx];
+			if (data.AnimInfo != anim)
+			{
+				data.AnimInfo = anim;
+				btn.SetButton(anim.m_DisplayName);
+			}
+			btn.Show();
 		}
 		
 		// Refresh scroller layout
@@ -147,7 +176,7 @@ class JMSwarmTestForm: JMFormBase
 	
 	void UpdatePageInfo()
 	{
-		int totalPages = Math.Max(1, Math.Ceil(m_FilteredAnimations.Count() / m_AnimsPerPage));
+		int totalPages = GetPageCount();
 		string pageText = string.Format("%1/%2 (%3)", m_CurrentPage + 1, totalPages, m_FilteredAnimations.Count());
 		m_PageInfo.SetText(pageText);
 		
@@ -201,7 +230,7 @@ class JMSwarmTestForm: JMFormBase
 		
 		if (guids.Count() > 0)
 		{
-			m_Module.PlayAnimation(anim.m_CommandID, anim.m_Type, anim.m_StanceMask, guids);
+			m_Module.PlayAnimation(anim.m_CommandID, anim.m_Type, anim.m_StanceMask, guids, m_SyncedCheckbox.IsChecked());
 		}
 	}
 	
@@ -219,6 +248,28 @@ class JMSwarmTestForm: JMFormBase
 		}
 	}
 	
+	void OnClick_PlayTimeline(UIEvent eid, UIActionBase action)
+	{
+		if (eid != UIEvent.CLICK)
+			return;
+		
+		string name = m_TimelineName.GetText();
+		name = name.Trim();
+		if (name == "")
+			return;
+		
+		// Selected players become the actors, in selection order
+		m_Module.PlayTimeline(name, JM_GetSelected().GetPlayersOrSelf());
+	}
+	
+	void OnClick_StopTimeline(UIEvent eid, UIActionBase action)
+	{
+		if (eid != UIEvent.CLICK)
+			return;
+		
+		m_Module.StopTimeline();
+	}
+	
 	void OnClick_PrevPage(UIEvent eid, UIActionBase action)
 	{
 		if (eid != UIEvent.CLICK)
@@ -237,8 +288,7 @@ class JMSwarmTestForm: JMFormBase
 		if (eid != UIEvent.CLICK)
 			return;
 		
-		int maxPages = Math.Ceil(m_FilteredAnimations.Count() / m_AnimsPerPage);
-		if (m_CurrentPage < maxPages - 1)
+		if (m_CurrentPage < GetPageCount() - 1)
 		{
 			m_CurrentPage++;
 			UpdateAnimationButtons();
@@ -1,11 +1,37 @@
 // SwarmTest Module for Community Online Tools
 class JMSwarmTestModule: JMRenderableModuleBase
 {
+	// Client clock sync, taken from the reply with the shortest round trip among the last CLOCK_SYNC_WINDOW
+	// Older samples fall out of the window, so a slowly drifting clock is still followed
+	protected int m_ServerTimeOffset; // Server time minus local time
+	protected int m_ClockRoundTrip = -1; // -1 until the first reply
+	protected ref array<int> m_ClockSampleRoundTrips = new array<int>;
+	protected ref array<int> m_ClockSampleOffsets = new array<int>;
+	protected int m_ClockSampleNext;
+	
+	protected ref SwarmTestAnimInfo m_ScheduledAnim; // Synced animation waiting for its start time
+	
 	void JMSwarmTestModule()
 	{
 		GetPermissionsManager().RegisterPermission("Admin.SwarmTest");
 		GetPermissionsManager().RegisterPermission("Admin.SwarmTest.Play");
 		GetPermissionsManager().RegisterPermission("Admin.SwarmTest.Stop");
+		
+		// Any player can be the target of a synced group animation, so every client keeps its clock offset
+		if (GetGame().IsClient())
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(SyncClock, SwarmTestConstants.CLOCK_SYNC_FIRST_MS, false);
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(SyncClock, SwarmTestConstants.CLOCK_SYNC_INTERVAL_MS, true);
+		}
+	}
+	
+	void ~JMSwarmTestModule()
+	{
+		if (GetGame())
+		{
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(SyncClock);
+			GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(PlayScheduledAnimation);
+		}
 	}
 
 	override bool HasAccess()
@@ -60,15 +86,31 @@ class JMSwarmTestModule: JMRenderableModuleBase
 			case JMSwarmTestModuleRPC.StopAnimationClient:
 				RPC_StopAnimationClient(ctx, sender, target);
 				break;
+			case JMSwarmTestModuleRPC.PlayAnimationGroupClient:
+				RPC_PlayAnimationGroupClient(ctx, sender, target);
+				break;
+			case JMSwarmTestModuleRPC.SyncClock:
+				RPC_SyncClock(ctx, sender, target);
+				break;
+			case JMSwarmTestModuleRPC.SyncClockClient:
+				RPC_SyncClockClient(ctx, sender, target);
+				break;
+			case JMSwarmTestModuleRPC.PlayTimeline:
+				RPC_PlayTimeline(ctx, sender, target);
+				break;
+			case JMSwarmTestModuleRPC.StopTimeline:
+				RPC_StopTimeline(ctx, sender, target);
+				break;
 		}
 	}
 	
 	// === Play Animation ===
-	void PlayAnimation(int commandID, int animType, int stanceMask, array<string> guids)
+	// synced: every target starts at the same server time instead of whenever its command arrives
+	void PlayAnimation(int commandID, int animType, int stanceMask, array<string> guids, bool synced = false)
 	{
 		if (IsMissionHost())
 		{
-			Exec_PlayAnimation(commandID, animType, stanceMask, guids, NULL);
+			Exec_PlayAnimation(commandID, animType, stanceMask, guids, synced, NULL);
 		}
 		else
 		{
@@ -77,6 +119,7 @@ class JMSwarmTestModule: JMRenderableModuleBase
 			rpc.Write(animType);
 			rpc.Write(stanceMask);
 			rpc.Write(guids);
+			rpc.Write(synced);
 			rpc.Send(NULL, JMSwarmTestModuleRPC.PlayAnimation, true, NULL);
 		}
 	}
@@ -99,59 +142,34 @@ class JMSwarmTestModule: JMRenderableModuleBase
 		if (!ctx.Read(guids))
 			return;
 
+		bool synced;
+		if (!ctx.Read(synced))
+			return;
+
 		JMPlayerInstance instance;
 		if (!GetPermissionsManager().HasPermission("Admin.SwarmTest.Play", senderRPC, instance))
 			return;
 
-		Exec_PlayAnimation(commandID, animType, stanceMask, guids, senderRPC);
+		Exec_PlayAnimation(commandID, animType, stanceMask, guids, synced, senderRPC);
 	}
 	
-	private void Exec_PlayAnimation(int commandID, int animType, int stanceMask, array<string> guids, PlayerIdentity ident)
+	private void Exec_PlayAnimation(int commandID, int animType, int stanceMask, array<string> guids, bool synced, PlayerIdentity ident)
 	{
-		array<JMPlayerInstance> players = GetPermissionsManager().GetPlayers(guids);
+		if (synced)
+		{
+			Exec_PlayAnimationGroup(commandID, animType, stanceMask, guids, ident);
+			return;
+		}
 		
-		// Check if this is a listen server (server + client in same process)
-		bool isListenServer = GetGame().IsServer() && !GetGame().IsDedicatedServer();
+		array<JMPlayerInstance> players = GetPermissionsManager().GetPlayers(guids);
+		SwarmTestAnimInfo tempInfo = new SwarmTestAnimInfo("temp", commandID, "", animType, stanceMask);
 
+		// The host's own player plays here, everyone else gets it forwarded to their client
 		foreach (JMPlayerInstance playerInstance : players)
 		{
 			PlayerBase player = PlayerBase.Cast(playerInstance.PlayerObject);
-			if (!player)
-				continue;
-
-			PlayerIdentity targetIdentity = player.GetIdentity();
-			
-			// On listen server: check if target is the local player
-			// ident is NULL when called from host, so we check if target matches local player
-			bool isLocalPlayer = false;
-			if (isListenServer)
-			{
-				PlayerBase localPlayer = PlayerBase.Cast(GetGame().GetPlayer());
-				isLocalPlayer = (player == localPlayer);
-			}
-			
-			if (isListenServer && isLocalPlayer)
-			{
-				// On listen server targeting ourselves: execute directly (no RPC needed)
-				Print("[SwarmTest] Listen server: executing animation directly - commandID=" + commandID + ", type=" + animType);
-				SwarmTestAnimInfo tempInfo = new SwarmTestAnimInfo("temp", commandID, "", animType, stanceMask);
-				SwarmTestAnimationHandler.PlayAnimationEx(player, tempInfo);
-			}
-			else if (targetIdentity)
-			{
-				// Remote player: send RPC to their client
-				Print("[SwarmTest] Server forwarding animation to client: commandID=" + commandID + ", type=" + animType + ", stanceMask=" + stanceMask);
-				
-				ScriptRPC rpc = new ScriptRPC();
-				rpc.Write(commandID);
-				rpc.Write(animType);
-				rpc.Write(stanceMask);
-				rpc.Send(player, JMSwarmTestModuleRPC.PlayAnimationClient, true, targetIdentity);
-			}
-			else
-			{
-				Print("[SwarmTest] Target player has no identity, skipping");
-			}
+			if (player)
+				SwarmTestAnimationHandler.PlayAnimationOnOwner(player, tempInfo);
 		}
 	}
 	
@@ -188,6 +206,253 @@ class JMSwarmTestModule: JMRenderableModuleBase
 		SwarmTestAnimationHandler.PlayAnimationEx(player, tempInfo);
 	}
 	
+	// === Synced Group Animation ===
+	// One command broadcast to every client, carrying the target GUIDs and a start time on the server clock.
+	// Targets schedule the start locally from their clock offset; everyone else drops it after the GUID lookup.
+	private void Exec_PlayAnimationGroup(int commandID, int animType, int stanceMask, array<string> guids, PlayerIdentity ident)
+	{
+		int startTime = GetGame().GetTime() + SwarmTestConstants.GROUP_START_DELAY_MS;
+		
+		// Listen server: the host's own player is scheduled here, its clock is the server clock
+		PlayerBase localPlayer = PlayerBase.Cast(GetGame().GetPlayer());
+		if (localPlayer && localPlayer.GetIdentity() && guids.Find(localPlayer.GetIdentity().GetId()) != -1)
+		{
+			ScheduleAnimation(new SwarmTestAnimInfo("temp", commandID, "", animType, stanceMask), startTime);
+		}
+		
+		if (!GetGame().IsMultiplayer())
+			return;
+		
+		Print("[SwarmTest] Server broadcasting synced animation: commandID=" + commandID + ", type=" + animType + ", targets=" + guids.Count() + ", start=" + startTime);
+		
+		ScriptRPC rpc = new ScriptRPC();
+		rpc.Write(commandID);
+		rpc.Write(animType);
+		rpc.Write(stanceMask);
+		rpc.Write(startTime);
+		rpc.Write(guids);
+		rpc.Send(NULL, JMSwarmTestModuleRPC.PlayAnimationGroupClient, true, NULL);
+	}
+	
+	private void RPC_PlayAnimationGroupClient(ParamsReadContext ctx, PlayerIdentity senderRPC, Object target)
+	{
+		// Only execute on client side (skip dedicated server)
+		if (GetGame().IsDedicatedServer())
+			return;
+		
+		int commandID;
+		if (!ctx.Read(commandID))
+			return;
+
+		int animType;
+		if (!ctx.Read(animType))
+			return;
+
+		int stanceMask;
+		if (!ctx.Read(stanceMask))
+			return;
+
+		int startTime;
+		if (!ctx.Read(startTime))
+			return;
+
+		array<string> guids;
+		if (!ctx.Read(guids))
+			return;
+
+		PlayerBase player = PlayerBase.Cast(GetGame().GetPlayer());
+		if (!player || !player.GetIdentity())
+			return;
+
+		if (guids.Find(player.GetIdentity().GetId()) == -1)
+			return;
+
+		ScheduleAnimation(new SwarmTestAnimInfo("temp", commandID, "", animType, stanceMask), startTime);
+	}
+	
+	// Start animInfo on the local player at serverStartTime, replacing any animation still waiting
+	protected void ScheduleAnimation(SwarmTestAnimInfo animInfo, int serverStartTime)
+	{
+		CancelScheduledAnimation();
+		m_ScheduledAnim = animInfo;
+		
+		// Without a clock sample yet the best we can do is start now
+		int delay = 0;
+		if (GetGame().IsServer())
+			delay = serverStartTime - GetGame().GetTime();
+		else if (m_ClockRoundTrip >= 0)
+			delay = serverStartTime - m_ServerTimeOffset - GetGame().GetTime();
+		
+		Print("[SwarmTest] Synced animation scheduled in " + delay + "ms: commandID=" + animInfo.m_CommandID);
+		
+		if (delay <= 0)
+		{
+			PlayScheduledAnimation();
+			return;
+		}
+		
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).CallLater(PlayScheduledAnimation, delay, false);
+	}
+	
+	protected void CancelScheduledAnimation()
+	{
+		GetGame().GetCallQueue(CALL_CATEGORY_SYSTEM).Remove(PlayScheduledAnimation);
+		m_ScheduledAnim = null;
+	}
+	
+	// Start the scheduled animation (called by timer)
+	protected void PlayScheduledAnimation()
+	{
+		PlayerBase player = PlayerBase.Cast(GetGame().GetPlayer());
+		if (player && m_ScheduledAnim)
+			SwarmTestAnimationHandler.PlayAnimationEx(player, m_ScheduledAnim);
+		
+		m_ScheduledAnim = null;
+	}
+	
+	// === Clock Sync ===
+	// Client sends its local time, the server answers with its own; half the round trip is the reply's age
+	protected void SyncClock()
+	{
+		ScriptRPC rpc = new ScriptRPC();
+		rpc.Write(GetGame().GetTime());
+		rpc.Send(NULL, JMSwarmTestModuleRPC.SyncClock, true, NULL);
+	}
+	
+	private void RPC_SyncClock(ParamsReadContext ctx, PlayerIdentity senderRPC, Object target)
+	{
+		if (!GetGame().IsServer() || !senderRPC)
+			return;
+		
+		int clientTime;
+		if (!ctx.Read(clientTime))
+			return;
+
+		ScriptRPC rpc = new ScriptRPC();
+		rpc.Write(clientTime);
+		rpc.Write(GetGame().GetTime());
+		rpc.Send(NULL, JMSwarmTestModuleRPC.SyncClockClient, true, senderRPC);
+	}
+	
+	private void RPC_SyncClockClient(ParamsReadContext ctx, PlayerIdentity senderRPC, Object target)
+	{
+		if (GetGame().IsDedicatedServer())
+			return;
+		
+		int clientTime;
+		if (!ctx.Read(clientTime))
+			return;
+
+		int serverTime;
+		if (!ctx.Read(serverTime))
+			return;
+
+		int now = GetGame().GetTime();
+		int roundTrip = now - clientTime;
+		int offset = serverTime + roundTrip / 2 - now;
+
+		// Replace the oldest sample once the window is full
+		if (m_ClockSampleRoundTrips.Count() < SwarmTestConstants.CLOCK_SYNC_WINDOW)
+		{
+			m_ClockSampleRoundTrips.Insert(roundTrip);
+			m_ClockSampleOffsets.Insert(offset);
+		}
+		else
+		{
+			m_ClockSampleRoundTrips[m_ClockSampleNext] = roundTrip;
+			m_ClockSampleOffsets[m_ClockSampleNext] = offset;
+		}
+		m_ClockSampleNext = (m_ClockSampleNext + 1) % SwarmTestConstants.CLOCK_SYNC_WINDOW;
+
+		int best = 0;
+		for (int i = 1; i < m_ClockSampleRoundTrips.Count(); i++)
+		{
+			if (m_ClockSampleRoundTrips[i] < m_ClockSampleRoundTrips[best])
+				best = i;
+		}
+
+		m_ClockRoundTrip = m_ClockSampleRoundTrips[best];
+		m_ServerTimeOffset = m_ClockSampleOffsets[best];
+	}
+	
+	// === Timeline ===
+	// Played on the server, the selected players take the tracks without a Player binding in order
+	void PlayTimeline(string name, array<string> guids)
+	{
+		if (IsMissionHost())
+		{
+			Exec_PlayTimeline(name, guids, NULL);
+		}
+		else
+		{
+			ScriptRPC rpc = new ScriptRPC();
+			rpc.Write(name);
+			rpc.Write(guids);
+			rpc.Send(NULL, JMSwarmTestModuleRPC.PlayTimeline, true, NULL);
+		}
+	}
+	
+	private void RPC_PlayTimeline(ParamsReadContext ctx, PlayerIdentity senderRPC, Object target)
+	{
+		string name;
+		if (!ctx.Read(name))
+			return;
+
+		array<string> guids;
+		if (!ctx.Read(guids))
+			return;
+
+		JMPlayerInstance instance;
+		if (!GetPermissionsManager().HasPermission("Admin.SwarmTest.Play", senderRPC, instance))
+			return;
+
+		Exec_PlayTimeline(name, guids, senderRPC);
+	}
+	
+	private void Exec_PlayTimeline(string name, array<string> guids, PlayerIdentity ident)
+	{
+		SwarmTestCompiledTimeline timeline = SwarmTestCompiledTimeline.Load(name);
+		if (!timeline)
+			return;
+		
+		array<PlayerBase> actors = new array<PlayerBase>;
+		foreach (JMPlayerInstance playerInstance : GetPermissionsManager().GetPlayers(guids))
+		{
+			PlayerBase player = PlayerBase.Cast(playerInstance.PlayerObject);
+			if (player)
+				actors.Insert(player);
+		}
+		
+		SwarmTestTimelinePlayer.GetInstance().Play(timeline, actors);
+	}
+	
+	void StopTimeline()
+	{
+		if (IsMissionHost())
+		{
+			Exec_StopTimeline(NULL);
+		}
+		else
+		{
+			ScriptRPC rpc = new ScriptRPC();
+			rpc.Send(NULL, JMSwarmTestModuleRPC.StopTimeline, true, NULL);
+		}
+	}
+	
+	private void RPC_StopTimeline(ParamsReadContext ctx, PlayerIdentity senderRPC, Object target)
+	{
+		JMPlayerInstance instance;
+		if (!GetPermissionsManager().HasPermission("Admin.SwarmTest.Stop", senderRPC, instance))
+			return;
+
+		Exec_StopTimeline(senderRPC);
+	}
+	
+	private void Exec_StopTimeline(PlayerIdentity ident)
+	{
+		SwarmTestTimelinePlayer.GetInstance().Stop();
+	}
+	
 	// === Stop Animation ===
 	void StopAnimation(array<string> guids)
 	{
@@ -243,6 +508,7 @@ class JMSwarmTestModule: JMRenderableModuleBase
 			{
 				// On listen server targeting ourselves: execute directly (no RPC needed)
 				Print("[SwarmTest] Listen server: stopping animation directly");
+				CancelScheduledAnimation();
 				SwarmTestAnimationHandler.EndCurrentAnimation(player);
 			}
 			else if (targetIdentity)
@@ -275,6 +541,7 @@ class JMSwarmTestModule: JMRenderableModuleBase
 		}
 
 		Print("[SwarmTest] Client stopping animation");
+		CancelScheduledAnimation();
 		SwarmTestAnimationHandler.EndCurrentAnimation(player);
 	}
 }
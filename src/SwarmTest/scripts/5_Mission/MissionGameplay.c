@@ -5,15 +5,4 @@ modded class MissionGameplay
 		super.OnInit();
 		Print("[SwarmTest] Initialized - Animation testing enabled");
 	}
-	
-	override void OnUpdate(float timeslice)
-	{
-		super.OnUpdate(timeslice);
-		
-		// Handle chat commands
-		PlayerBase player = PlayerBase.Cast(GetGame().GetPlayer());
-		
-		if (!player)
-			return;
-	}
 }
@@ -5,6 +5,11 @@ modded class MissionServer
 		super.OnInit();
 		Print("[SwarmTest] Server initialized - Animation commands enabled");
 		GetRPCManager().AddRPC("", "SwarmTestRPC_AnimCommand", this, SingleplayerExecutionType.Server);
+		
+		MakeDirectory(SwarmTestConstants.DIR_SWARM_TEST);
+		MakeDirectory(SwarmTestConstants.DIR_TIMELINES);
+		
+		SwarmTestCoverageRunner.Start();
 	}
 	
 	void SwarmTestRPC_AnimCommand(CallType type, ParamsReadContext ctx, PlayerIdentity sender, Object target)